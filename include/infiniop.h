@@ -3,20 +3,29 @@
 
 #include "infiniop/handle.h"
 #include "infiniop/ops/add.h"
+#include "infiniop/ops/add_rms_norm.h"
 #include "infiniop/ops/attention.h"
+#include "infiniop/ops/cast.h"
 #include "infiniop/ops/causal_softmax.h"
 #include "infiniop/ops/clip.h"
 #include "infiniop/ops/conv.h"
+#include "infiniop/ops/fused_elementwise.h"
 #include "infiniop/ops/gemm.h"
+#include "infiniop/ops/gguf_gemm.h"
+#include "infiniop/ops/grouped_gemm.h"
+#include "infiniop/ops/int8_gemm.h"
+#include "infiniop/ops/layer_norm.h"
 #include "infiniop/ops/mul.h"
 #include "infiniop/ops/random_sample.h"
 #include "infiniop/ops/rearrange.h"
+#include "infiniop/ops/reduce.h"
 #include "infiniop/ops/relu.h"
 #include "infiniop/ops/rms_norm.h"
 #include "infiniop/ops/rope.h"
 #include "infiniop/ops/sub.h"
 #include "infiniop/ops/swiglu.h"
 #include "infiniop/ops/awq_dequantize.h"
+#include "infiniop/ops/awq_gemm.h"
 #include "infiniop/tensor_descriptor.h"
 
 #endif // __INFINIOP_API_H__
@@ -0,0 +1,45 @@
+#ifndef __INFINIOP_ADD_RMS_NORM_API_H__
+#define __INFINIOP_ADD_RMS_NORM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopAddRMSNormDescriptor_t;
+
+/**
+ * Residual add followed by RMSNorm in one pass, currently implemented on CPU
+ * only:
+ *
+ *     residual_out = x + residual
+ *     y = residual_out / sqrt(mean(residual_out^2, -1) + epsilon) * w
+ *
+ * Tensor shapes and dtypes follow `infiniopCreateRMSNormDescriptor`;
+ * `residual` and `residual_out` have the shape and dtype of `x`. The norm is
+ * taken over `residual_out` as stored, so the results match the separate add
+ * and RMSNorm ops. `residual_out` may be the same buffer as `x` or `residual`.
+ */
+__C __export infiniStatus_t infiniopCreateAddRMSNormDescriptor(
+    infiniopHandle_t handle,
+    infiniopAddRMSNormDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t residual_out_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t residual_desc,
+    infiniopTensorDescriptor_t w_desc,
+    float epsilon);
+
+__C __export infiniStatus_t infiniopGetAddRMSNormWorkspaceSize(infiniopAddRMSNormDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopAddRMSNorm(
+    infiniopAddRMSNormDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    void *residual_out,
+    const void *x,
+    const void *residual,
+    const void *w,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyAddRMSNormDescriptor(infiniopAddRMSNormDescriptor_t desc);
+
+#endif // __INFINIOP_ADD_RMS_NORM_API_H__
@@ -0,0 +1,47 @@
+#ifndef __INFINIOP_AWQ_GEMM_API_H__
+#define __INFINIOP_AWQ_GEMM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopAWQGemmDescriptor_t;
+
+/**
+ * W4A16 matmul with AWQ weights: `c = a * dequantize(qweight, zeros, scales)`.
+ *
+ * - `a` is `[m, k]` and `c` is `[m, n]`, both F16, BF16 or F32 of the same type;
+ * - `qweight` (I32 `[k, n / 8]`), `zeros` (I32 `[k / group_size, n / 8]`) and
+ *   `scales` (F16, BF16 or F32 `[k / group_size, n]`) use the same packing as
+ *   `infiniopAWQDequantize`, and must be contiguous.
+ *
+ * The 4-bit weights are dequantized inside the kernel, the full-precision
+ * weight matrix is never materialized.
+ */
+__C __export infiniStatus_t infiniopCreateAWQGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopAWQGemmDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t qweight_desc,
+    infiniopTensorDescriptor_t zeros_desc,
+    infiniopTensorDescriptor_t scales_desc,
+    int group_size);
+
+__C __export infiniStatus_t infiniopGetAWQGemmWorkspaceSize(
+    infiniopAWQGemmDescriptor_t desc,
+    size_t *size);
+
+__C __export infiniStatus_t infiniopAWQGemm(
+    infiniopAWQGemmDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *qweight,
+    const void *zeros,
+    const void *scales,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyAWQGemmDescriptor(
+    infiniopAWQGemmDescriptor_t desc);
+
+#endif // __INFINIOP_AWQ_GEMM_API_H__
@@ -0,0 +1,38 @@
+#ifndef __INFINIOP_CAST_API_H__
+#define __INFINIOP_CAST_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopCastDescriptor_t;
+
+/**
+ * Converts `x` to the dtype of `y`, currently implemented on CPU only.
+ *
+ * Both tensors may be BOOL, I8, I16, I32, I64, U8, U16, U32, U64, F16, BF16, F32
+ * or F64, with the same shape and arbitrary strides; `x` may broadcast with zero
+ * strides. Narrowing to a floating-point dtype rounds to nearest even; F16 and
+ * BF16 go through F32. Conversion to an integer dtype truncates toward zero,
+ * and the result for NaN or out-of-range values is unspecified.
+ *
+ * `y` must not overlap `x`, except for an in-place cast between dtypes of the
+ * same size.
+ */
+__C __export infiniStatus_t infiniopCreateCastDescriptor(
+    infiniopHandle_t handle,
+    infiniopCastDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc);
+
+__C __export infiniStatus_t infiniopGetCastWorkspaceSize(infiniopCastDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopCast(
+    infiniopCastDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyCastDescriptor(infiniopCastDescriptor_t desc);
+
+#endif // __INFINIOP_CAST_API_H__
@@ -0,0 +1,69 @@
+#ifndef __INFINIOP_FUSED_ELEMENTWISE_API_H__
+#define __INFINIOP_FUSED_ELEMENTWISE_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopFusedElementwiseDescriptor_t;
+
+// Elementwise operators usable in a fused expression, with their operands in order
+typedef enum {
+    INFINIOP_ELEMENTWISE_ADD = 0,    // a + b
+    INFINIOP_ELEMENTWISE_SUB = 1,    // a - b
+    INFINIOP_ELEMENTWISE_MUL = 2,    // a * b
+    INFINIOP_ELEMENTWISE_RELU = 3,   // max(x, 0)
+    INFINIOP_ELEMENTWISE_CLIP = 4,   // max(min(x, max_val), min_val), operands x, min_val, max_val
+    INFINIOP_ELEMENTWISE_SWIGLU = 5, // up * silu(gate), operands up, gate
+} infiniopElementwiseOp_t;
+
+// Maximum number of inputs and of nodes in a fused expression
+#define INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS 8
+#define INFINIOP_FUSED_ELEMENTWISE_MAX_NODES 32
+
+/**
+ * One node of a fused expression. Operand `i` of `op` is `operands[i]`:
+ * values below `input_count` refer to the inputs `x[operands[i]]`, value
+ * `input_count + k` refers to the result of node `k`, which must come before
+ * this node. Operands beyond the arity of `op` are ignored.
+ */
+typedef struct {
+    infiniopElementwiseOp_t op;
+    unsigned int operands[3];
+} infiniopElementwiseNode_t;
+
+/**
+ * Evaluates an expression DAG of elementwise operators in one pass, currently
+ * implemented on CPU only: every input is read once and the result of the last
+ * node is written to `y`, intermediate values never leave registers.
+ *
+ * For example `y = clip(a * b + c, lo, hi)` over inputs `a, b, c, lo, hi` is
+ * `{MUL, {0, 1}}, {ADD, {5, 2}}, {CLIP, {6, 3, 4}}`.
+ *
+ * All inputs have the shape and dtype (F16, BF16 or F32) of `y`; broadcasting is
+ * expressed with zero strides as for the single operators. Values are computed
+ * in fp32.
+ */
+__C __export infiniStatus_t infiniopCreateFusedElementwiseDescriptor(
+    infiniopHandle_t handle,
+    infiniopFusedElementwiseDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    size_t input_count,
+    const infiniopTensorDescriptor_t *x_descs,
+    size_t node_count,
+    const infiniopElementwiseNode_t *nodes);
+
+__C __export infiniStatus_t infiniopGetFusedElementwiseWorkspaceSize(
+    infiniopFusedElementwiseDescriptor_t desc,
+    size_t *size);
+
+__C __export infiniStatus_t infiniopFusedElementwise(
+    infiniopFusedElementwiseDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *const *x,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyFusedElementwiseDescriptor(
+    infiniopFusedElementwiseDescriptor_t desc);
+
+#endif // __INFINIOP_FUSED_ELEMENTWISE_API_H__
@@ -5,6 +5,13 @@
 
 typedef struct InfiniopDescriptor *infiniopGemmDescriptor_t;
 
+typedef enum {
+    INFINIOP_ACTIVATION_NONE = 0,
+    INFINIOP_ACTIVATION_RELU = 1,
+    INFINIOP_ACTIVATION_SILU = 2,
+    INFINIOP_ACTIVATION_GELU = 3, // tanh approximation
+} infiniopActivation_t;
+
 __C __export infiniStatus_t infiniopCreateGemmDescriptor(infiniopHandle_t handle,
                                                          infiniopGemmDescriptor_t *desc_ptr,
                                                          infiniopTensorDescriptor_t c_desc,
@@ -23,6 +30,68 @@ __C __export infiniStatus_t infiniopGemm(infiniopGemmDescriptor_t desc,
                                          float beta,
                                          void *stream);
 
+/**
+ * Pre-packing of a constant B (e.g. weights), currently implemented on CPU only.
+ *
+ * `infiniopGemmPrepackB` writes B into `packed_b`, which must hold
+ * `infiniopGetGemmPackedBSize` bytes (64-byte alignment recommended), in the
+ * layout used internally by the descriptor's kernels. `infiniopGemmPrepacked`
+ * then computes the same result as `infiniopGemm` without re-packing B.
+ * A packed buffer is only valid for the descriptor that produced it.
+ */
+__C __export infiniStatus_t infiniopGetGemmPackedBSize(infiniopGemmDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopGemmPrepackB(infiniopGemmDescriptor_t desc,
+                                                 void *packed_b,
+                                                 void const *b,
+                                                 void *stream);
+
+__C __export infiniStatus_t infiniopGemmPrepacked(infiniopGemmDescriptor_t desc,
+                                                  void *workspace,
+                                                  size_t workspace_size,
+                                                  void *c,
+                                                  void const *a,
+                                                  void const *packed_b,
+                                                  float alpha,
+                                                  float beta,
+                                                  void *stream);
+
+/**
+ * Gemm with a fused epilogue, currently implemented on CPU only:
+ *
+ * `c = act(alpha * a * b + beta * c + bias) + residual`
+ *
+ * `bias` is a 1-D tensor of length `c.shape[-1]` broadcast over the rows of c,
+ * `residual` has the shape of c; both have the dtype of c and may be omitted
+ * by passing a null descriptor. The epilogue is applied to each output tile
+ * while it is written, instead of in separate passes over c.
+ *
+ * The descriptor is destroyed with `infiniopDestroyGemmDescriptor` and its
+ * workspace size is queried with `infiniopGetGemmWorkspaceSize`. Calling
+ * `infiniopGemm` or `infiniopGemmPrepacked` on it applies the activation and
+ * fails with `INFINI_STATUS_BAD_PARAM` if a bias or residual is required.
+ */
+__C __export infiniStatus_t infiniopCreateGemmEpilogueDescriptor(infiniopHandle_t handle,
+                                                                 infiniopGemmDescriptor_t *desc_ptr,
+                                                                 infiniopTensorDescriptor_t c_desc,
+                                                                 infiniopTensorDescriptor_t a_desc,
+                                                                 infiniopTensorDescriptor_t b_desc,
+                                                                 infiniopTensorDescriptor_t bias_desc,
+                                                                 infiniopTensorDescriptor_t residual_desc,
+                                                                 infiniopActivation_t activation);
+
+__C __export infiniStatus_t infiniopGemmEpilogue(infiniopGemmDescriptor_t desc,
+                                                 void *workspace,
+                                                 size_t workspace_size,
+                                                 void *c,
+                                                 void const *a,
+                                                 void const *b,
+                                                 void const *bias,
+                                                 void const *residual,
+                                                 float alpha,
+                                                 float beta,
+                                                 void *stream);
+
 __C __export infiniStatus_t infiniopDestroyGemmDescriptor(infiniopGemmDescriptor_t desc);
 
 #endif
@@ -0,0 +1,51 @@
+#ifndef __INFINIOP_GGUF_GEMM_API_H__
+#define __INFINIOP_GGUF_GEMM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopGGUFGemmDescriptor_t;
+
+// GGUF block-quantized weight formats, the values match `GGML_TYPE_*`
+typedef enum {
+    INFINIOP_GGUF_TYPE_Q4_0 = 2,  // blocks of 32: f16 scale, 4-bit values offset by 8
+    INFINIOP_GGUF_TYPE_Q8_0 = 8,  // blocks of 32: f16 scale, 8-bit values
+    INFINIOP_GGUF_TYPE_Q4_K = 12, // super-blocks of 256: f16 scale and min, 6-bit sub-block scales and mins, 4-bit values
+} infiniopGGUFType_t;
+
+/**
+ * Matmul against GGUF weights: `c[i, j] = sum_p(a[i, p] * w[j, p])`, i.e. `c = a * w^T`
+ * as `ggml_mul_mat` computes it.
+ *
+ * - `a` is `[m, k]` and `c` is `[m, n]`, both F16, BF16 or F32 of the same type;
+ * - `w_desc` describes the raw GGUF tensor as U8 `[n, row_bytes]`, each row
+ *   holding `k` values as consecutive blocks of `w_type`; `k` must be a multiple
+ *   of the block size (32, or 256 for the K formats).
+ *
+ * Activations are quantized to 8 bits per block of 32 in the workspace and
+ * multiplied with the weights in integer arithmetic, as ggml does on CPU.
+ */
+__C __export infiniStatus_t infiniopCreateGGUFGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopGGUFGemmDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t w_desc,
+    infiniopGGUFType_t w_type);
+
+__C __export infiniStatus_t infiniopGetGGUFGemmWorkspaceSize(
+    infiniopGGUFGemmDescriptor_t desc,
+    size_t *size);
+
+__C __export infiniStatus_t infiniopGGUFGemm(
+    infiniopGGUFGemmDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *w,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyGGUFGemmDescriptor(
+    infiniopGGUFGemmDescriptor_t desc);
+
+#endif // __INFINIOP_GGUF_GEMM_API_H__
@@ -0,0 +1,49 @@
+#ifndef __INFINIOP_GROUPED_GEMM_API_H__
+#define __INFINIOP_GROUPED_GEMM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopGroupedGemmDescriptor_t;
+
+/**
+ * A group of independent Gemms computed in one call, currently implemented on CPU only:
+ *
+ * `c[g] = alpha * a[g] * b[g] + beta * c[g]` for `g < group_count`
+ *
+ * Each group is described by its own `c_descs[g]`, `a_descs[g]` and `b_descs[g]`
+ * with the same rules as `infiniopCreateGemmDescriptor`, so shapes, strides and
+ * batch sizes may differ between groups; all groups share one dtype. The data
+ * of each group is passed through the pointer arrays `c`, `a` and `b`, which
+ * hold `group_count` arbitrary base pointers.
+ *
+ * This serves workloads made of many small Gemms (MoE experts, multi-LoRA,
+ * ragged batches): the tiles of all groups are balanced across threads
+ * together instead of running the Gemms one after another.
+ */
+__C __export infiniStatus_t infiniopCreateGroupedGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopGroupedGemmDescriptor_t *desc_ptr,
+    size_t group_count,
+    const infiniopTensorDescriptor_t *c_descs,
+    const infiniopTensorDescriptor_t *a_descs,
+    const infiniopTensorDescriptor_t *b_descs);
+
+__C __export infiniStatus_t infiniopGetGroupedGemmWorkspaceSize(
+    infiniopGroupedGemmDescriptor_t desc,
+    size_t *size);
+
+__C __export infiniStatus_t infiniopGroupedGemm(
+    infiniopGroupedGemmDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *const *c,
+    const void *const *a,
+    const void *const *b,
+    float alpha,
+    float beta,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyGroupedGemmDescriptor(
+    infiniopGroupedGemmDescriptor_t desc);
+
+#endif // __INFINIOP_GROUPED_GEMM_API_H__
@@ -0,0 +1,43 @@
+#ifndef __INFINIOP_INT8_GEMM_API_H__
+#define __INFINIOP_INT8_GEMM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopInt8GemmDescriptor_t;
+
+/**
+ * Quantized matmul: `c[i, j] = a_scale[i] * b_scale[j] * sum_k(a[i, k] * b[k, j])`.
+ *
+ * - `a` and `b` are I8 and are multiplied exactly in int32;
+ * - `c` is F16, BF16 or F32;
+ * - `a_scale` is F32 with the shape of `a` without its last dimension
+ *   (`[m]` or `[batch, m]`), `b_scale` is F32 with the shape of `b` without
+ *   its k dimension (`[n]` or `[batch, n]`); a 1-D scale is shared by all
+ *   batches and a null descriptor means a scale of 1.
+ *
+ * Operands that are contiguous along k are read in place (e.g. weights stored
+ * as `[n, k]` and passed transposed), others are copied to the workspace.
+ */
+__C __export infiniStatus_t infiniopCreateInt8GemmDescriptor(infiniopHandle_t handle,
+                                                             infiniopInt8GemmDescriptor_t *desc_ptr,
+                                                             infiniopTensorDescriptor_t c_desc,
+                                                             infiniopTensorDescriptor_t a_desc,
+                                                             infiniopTensorDescriptor_t b_desc,
+                                                             infiniopTensorDescriptor_t a_scale_desc,
+                                                             infiniopTensorDescriptor_t b_scale_desc);
+
+__C __export infiniStatus_t infiniopGetInt8GemmWorkspaceSize(infiniopInt8GemmDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopInt8Gemm(infiniopInt8GemmDescriptor_t desc,
+                                             void *workspace,
+                                             size_t workspace_size,
+                                             void *c,
+                                             void const *a,
+                                             void const *b,
+                                             void const *a_scale,
+                                             void const *b_scale,
+                                             void *stream);
+
+__C __export infiniStatus_t infiniopDestroyInt8GemmDescriptor(infiniopInt8GemmDescriptor_t desc);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __INFINIOP_LAYER_NORM_API_H__
+#define __INFINIOP_LAYER_NORM_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopLayerNormDescriptor_t;
+
+/**
+ * LayerNorm over the last dimension, currently implemented on CPU only:
+ *
+ *     y = (x - mean(x, -1)) / sqrt(var(x, -1) + epsilon) * w + b
+ *
+ * `var` is the biased variance. Tensor shapes and dtypes follow
+ * `infiniopCreateRMSNormDescriptor`; `b` has the shape and dtype of `w` and
+ * may be omitted by passing a null descriptor. Statistics of fp16/bf16 inputs
+ * are computed in fp32. The presence of `b` in `infiniopLayerNorm` must match
+ * the descriptor: it fails with `INFINI_STATUS_BAD_PARAM` if the descriptor was
+ * created with `b_desc` and `b` is null, or without `b_desc` and `b` is not
+ * null.
+ */
+__C __export infiniStatus_t infiniopCreateLayerNormDescriptor(
+    infiniopHandle_t handle,
+    infiniopLayerNormDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_desc,
+    infiniopTensorDescriptor_t b_desc,
+    float epsilon);
+
+__C __export infiniStatus_t infiniopGetLayerNormWorkspaceSize(infiniopLayerNormDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopLayerNorm(
+    infiniopLayerNormDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *w,
+    const void *b,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyLayerNormDescriptor(infiniopLayerNormDescriptor_t desc);
+
+#endif // __INFINIOP_LAYER_NORM_API_H__
@@ -0,0 +1,52 @@
+#ifndef __INFINIOP_REDUCE_API_H__
+#define __INFINIOP_REDUCE_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopReduceDescriptor_t;
+
+// Reductions over the selected axes, the result of an empty reduction in brackets
+typedef enum {
+    INFINIOP_REDUCE_SUM = 0,  // sum(x) (0)
+    INFINIOP_REDUCE_MEAN = 1, // sum(x) / count (NaN)
+    INFINIOP_REDUCE_MAX = 2,  // max(x) (-inf)
+    INFINIOP_REDUCE_MIN = 3,  // min(x) (inf)
+    INFINIOP_REDUCE_PROD = 4, // prod(x) (1)
+    INFINIOP_REDUCE_L2 = 5,   // sqrt(sum(x * x)) (0)
+} infiniopReduceOp_t;
+
+/**
+ * Reduces `x` over `axes` with `op`, currently implemented on CPU only.
+ *
+ * `axes` lists `axis_count` distinct dimensions of `x`; an empty list reduces
+ * nothing. With `keepdim` non-zero `y` has the rank of `x` with the reduced
+ * dimensions of size 1, otherwise the reduced dimensions are removed. `x` and
+ * `y` are F16, BF16 or F32 of the same type with arbitrary strides; values are
+ * accumulated in fp32. MAX and MIN are NaN where any reduced element is NaN.
+ *
+ * When there are too few outputs to occupy all threads, each output is reduced
+ * by several threads that combine their partial results in the workspace.
+ */
+__C __export infiniStatus_t infiniopCreateReduceDescriptor(
+    infiniopHandle_t handle,
+    infiniopReduceDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    const size_t *axes,
+    size_t axis_count,
+    int keepdim,
+    infiniopReduceOp_t op);
+
+__C __export infiniStatus_t infiniopGetReduceWorkspaceSize(infiniopReduceDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopReduce(
+    infiniopReduceDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyReduceDescriptor(infiniopReduceDescriptor_t desc);
+
+#endif // __INFINIOP_REDUCE_API_H__
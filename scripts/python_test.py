@@ -13,18 +13,28 @@ def run_tests(args):
     failed = []
     for test in [
         "add.py",
+        "add_rms_norm.py",
         "attention.py",
+        "cast.py",
         "causal_softmax.py",
         "clip.py",
+        "fused_elementwise.py",
         "gemm.py",
+        "gemm_epilogue.py",
+        "gguf_gemm.py",
+        "grouped_gemm.py",
+        "int8_gemm.py",
+        "layer_norm.py",
         "mul.py",
         "random_sample.py",
         "rearrange.py",
+        "reduce.py",
         "rms_norm.py",
         "rope.py",
         "sub.py",
         "swiglu.py",
         "awq_dequantize.py",
+        "awq_gemm.py",
     ]:
         result = subprocess.run(
             f"python {test} {args} --debug", text=True, encoding="utf-8", shell=True
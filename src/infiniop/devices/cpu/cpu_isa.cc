@@ -0,0 +1,99 @@
+#include "cpu_isa.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef INFINIOP_CPU_X86_SIMD
+#include <cpuid.h>
+#endif
+
+namespace device::cpu {
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+static uint64_t xgetbv0() {
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (uint64_t(edx) << 32) | eax;
+}
+
+static IsaInfo detect() {
+    IsaInfo info{};
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return info;
+    }
+    bool fma = ecx & (1u << 12);
+    bool osxsave = ecx & (1u << 27);
+    bool avx = ecx & (1u << 28);
+    bool f16c = ecx & (1u << 29);
+    if (!osxsave || !avx) {
+        return info;
+    }
+
+    // 操作系统需要保存 ymm（以及 zmm/opmask）寄存器状态
+    uint64_t xcr0 = xgetbv0();
+    bool ymm_state = (xcr0 & 0x6) == 0x6;
+    bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+    if (!ymm_state) {
+        return info;
+    }
+
+    if (__get_cpuid_max(0, nullptr) < 7) {
+        return info;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    bool avx2 = ebx & (1u << 5);
+    bool avx512f = ebx & (1u << 16);
+    bool avx512dq = ebx & (1u << 17);
+    bool avx512bw = ebx & (1u << 30);
+    bool avx512vl = ebx & (1u << 31);
+    bool avx512_vnni = ecx & (1u << 11);
+    uint32_t max_subleaf = eax;
+
+    bool avx_vnni = false, avx512_bf16 = false;
+    if (max_subleaf >= 1) {
+        __cpuid_count(7, 1, eax, ebx, ecx, edx);
+        avx_vnni = eax & (1u << 4);
+        avx512_bf16 = eax & (1u << 5);
+    }
+
+    info.avx2 = avx2 && fma;
+    info.f16c = f16c;
+    info.avx512 = info.avx2 && zmm_state && avx512f && avx512dq && avx512bw && avx512vl;
+    info.avx512_bf16 = info.avx512 && avx512_bf16;
+    info.avx512_vnni = info.avx512 && avx512_vnni;
+    info.avx_vnni = info.avx2 && avx_vnni;
+    return info;
+}
+
+#else
+
+static IsaInfo detect() {
+    return IsaInfo{};
+}
+
+#endif
+
+static IsaInfo applyLimit(IsaInfo info) {
+    const char *limit = std::getenv("INFINIOP_CPU_MAX_ISA");
+    if (limit == nullptr) {
+        return info;
+    }
+    if (std::strcmp(limit, "scalar") == 0) {
+        info = IsaInfo{};
+    } else if (std::strcmp(limit, "avx2") == 0 || std::strcmp(limit, "avxvnni") == 0) {
+        info.avx512 = false;
+        info.avx512_bf16 = false;
+        info.avx512_vnni = false;
+        info.avx_vnni = info.avx_vnni && std::strcmp(limit, "avxvnni") == 0;
+    }
+    return info;
+}
+
+const IsaInfo &isa() {
+    static const IsaInfo info = applyLimit(detect());
+    return info;
+}
+
+} // namespace device::cpu
@@ -0,0 +1,56 @@
+#ifndef __INFINIOP_CPU_ISA_H__
+#define __INFINIOP_CPU_ISA_H__
+
+#include "../../../utils/simd_diagnostic.h"
+
+/**
+ * Runtime detection of the SIMD extensions available on the host CPU.
+ *
+ * Kernels are compiled for the baseline architecture; functions that use wider
+ * instruction sets are marked with `INFINIOP_CPU_TARGET(...)` and only called
+ * after checking `device::cpu::isa()`.
+ *
+ * Code using AVX-512 intrinsics is wrapped in `INFINIUTILS_AVX512_WARNINGS_PUSH`
+ * / `INFINIUTILS_AVX512_WARNINGS_POP` (see utils/simd_diagnostic.h).
+ *
+ * The environment variable `INFINIOP_CPU_MAX_ISA` (`scalar`, `avx2`, `avxvnni`,
+ * `avx512`) caps the detected level, which is useful to test the fallback paths.
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+#define INFINIOP_CPU_X86_SIMD
+#define INFINIOP_CPU_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#define INFINIOP_CPU_TARGET(ISA)
+#endif
+
+// infinicore.h 中的 `__C` 宏与 intrinsics 头文件中的形参名冲突，包含前临时取消定义
+#ifdef INFINIOP_CPU_X86_SIMD
+#pragma push_macro("__C")
+#undef __C
+#include <immintrin.h>
+#pragma pop_macro("__C")
+#endif
+
+namespace device::cpu {
+
+struct IsaInfo {
+    // AVX2 + FMA, the baseline for all vectorized x86 kernels
+    bool avx2;
+    // F16C: packed fp16 <-> fp32 conversion
+    bool f16c;
+    // AVX-512 F/BW/DQ/VL
+    bool avx512;
+    // AVX512_BF16: packed bf16 dot products and fp32 -> bf16 conversion
+    bool avx512_bf16;
+    // AVX512_VNNI: u8 x s8 -> s32 dot products on zmm registers
+    bool avx512_vnni;
+    // AVX-VNNI: u8 x s8 -> s32 dot products on ymm registers
+    bool avx_vnni;
+};
+
+const IsaInfo &isa();
+
+} // namespace device::cpu
+
+#endif // __INFINIOP_CPU_ISA_H__
@@ -0,0 +1,165 @@
+#include "cpu_math.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace device::cpu::math {
+
+Accuracy defaultAccuracy() {
+    static const Accuracy accuracy = [] {
+        const char *fast = std::getenv("INFINIOP_CPU_FAST_MATH");
+        return fast && std::strcmp(fast, "1") == 0 ? Accuracy::FAST : Accuracy::ACCURATE;
+    }();
+    return accuracy;
+}
+
+namespace {
+
+// 各函数的标量、AVX2 与 AVX-512 形式，由下面的 apply 逐段调用
+
+template <Accuracy A>
+struct Exp {
+    float scale, shift;
+
+    float operator()(float x) const {
+        return std::exp(x * scale + shift);
+    }
+#ifdef INFINIOP_CPU_X86_SIMD
+    INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+    __m256 operator()(__m256 x) const {
+        return expAvx2<A>(_mm256_fmadd_ps(x, _mm256_set1_ps(scale), _mm256_set1_ps(shift)));
+    }
+    INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+    __m512 operator()(__m512 x) const {
+        return expAvx512<A>(_mm512_fmadd_ps(x, _mm512_set1_ps(scale), _mm512_set1_ps(shift)));
+    }
+#endif
+};
+
+// 与向量形式相同，用 sigmoid 的形式在 fp64 中计算：避免 1 + tanh 在 x 为负数时的相消，指数的参数也不会溢出
+float geluScalar(float x) {
+    const double xd = x;
+    const double t = -2. * 0.7978845608028654 * (xd + 0.044715 * xd * xd * xd);
+    return float(t > 0 ? xd * std::exp(-t) / (1. + std::exp(-t)) : xd / (1. + std::exp(t)));
+}
+
+// 无额外参数的函数：NAME 的标量形式为 SCALAR，向量形式为 NAME##Avx2 与 NAME##Avx512
+#define DEFINE_UNARY(STRUCT, NAME, SCALAR)                      \
+    template <Accuracy A>                                       \
+    struct STRUCT {                                             \
+        float operator()(float x) const {                       \
+            return SCALAR;                                      \
+        }                                                       \
+        DEFINE_UNARY_SIMD(NAME)                                 \
+    };
+
+#ifdef INFINIOP_CPU_X86_SIMD
+#define DEFINE_UNARY_SIMD(NAME)                      \
+    INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)      \
+    __m256 operator()(__m256 x) const {              \
+        return NAME##Avx2<A>(x);                     \
+    }                                                \
+    INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)    \
+    __m512 operator()(__m512 x) const {              \
+        return NAME##Avx512<A>(x);                   \
+    }
+#else
+#define DEFINE_UNARY_SIMD(NAME)
+#endif
+
+DEFINE_UNARY(Log, log, std::log(x))
+DEFINE_UNARY(Sigmoid, sigmoid, 1.f / (1.f + std::exp(-x)))
+DEFINE_UNARY(Tanh, tanh, std::tanh(x))
+DEFINE_UNARY(Silu, silu, x / (1.f + std::exp(-x)))
+DEFINE_UNARY(Gelu, gelu, geluScalar(x))
+
+#undef DEFINE_UNARY
+#undef DEFINE_UNARY_SIMD
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// 尾部用 maskload/maskstore，使每个元素都经过相同的向量计算
+template <typename F>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+void applyAvx2(const F &f, float *y, const float *x, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, f(_mm256_loadu_ps(x + i)));
+    }
+    if (i < n) {
+        const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(n - i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        _mm256_maskstore_ps(y + i, mask, f(_mm256_maskload_ps(x + i, mask)));
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+template <typename F>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+void applyAvx512(const F &f, float *y, const float *x, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, f(_mm512_loadu_ps(x + i)));
+    }
+    if (i < n) {
+        const __mmask16 mask = __mmask16((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(y + i, mask, f(_mm512_maskz_loadu_ps(mask, x + i)));
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+template <typename F>
+void apply(const F &f, float *y, const float *x, size_t n) {
+#ifdef INFINIOP_CPU_X86_SIMD
+    const auto &isa = device::cpu::isa();
+    if (isa.avx512) {
+        return applyAvx512(f, y, x, n);
+    }
+    if (isa.avx2) {
+        return applyAvx2(f, y, x, n);
+    }
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = f(x[i]);
+    }
+}
+
+template <template <Accuracy> class F, typename... Args>
+void apply(Accuracy accuracy, float *y, const float *x, size_t n, Args... args) {
+    if (accuracy == Accuracy::FAST) {
+        apply(F<Accuracy::FAST>{args...}, y, x, n);
+    } else {
+        apply(F<Accuracy::ACCURATE>{args...}, y, x, n);
+    }
+}
+
+} // namespace
+
+void exp(float *y, const float *x, size_t n, float scale, float shift, Accuracy accuracy) {
+    apply<Exp>(accuracy, y, x, n, scale, shift);
+}
+
+void log(float *y, const float *x, size_t n, Accuracy accuracy) {
+    apply<Log>(accuracy, y, x, n);
+}
+
+void sigmoid(float *y, const float *x, size_t n, Accuracy accuracy) {
+    apply<Sigmoid>(accuracy, y, x, n);
+}
+
+void tanh(float *y, const float *x, size_t n, Accuracy accuracy) {
+    apply<Tanh>(accuracy, y, x, n);
+}
+
+void silu(float *y, const float *x, size_t n, Accuracy accuracy) {
+    apply<Silu>(accuracy, y, x, n);
+}
+
+void gelu(float *y, const float *x, size_t n, Accuracy accuracy) {
+    apply<Gelu>(accuracy, y, x, n);
+}
+
+} // namespace device::cpu::math
@@ -0,0 +1,395 @@
+#ifndef __INFINIOP_CPU_MATH_H__
+#define __INFINIOP_CPU_MATH_H__
+
+#include "cpu_isa.h"
+#include <cstddef>
+
+/**
+ * Vectorized transcendental functions on fp32 for CPU kernels.
+ *
+ * Each function comes in two forms:
+ *
+ * - per-register `fooAvx2(__m256)` / `fooAvx512(__m512)`, for kernels that are
+ *   already vectorized (e.g. the vector forms of the elementwise ops). They are
+ *   inline and marked with `INFINIOP_CPU_MATH_AVX2` / `INFINIOP_CPU_MATH_AVX512`,
+ *   so they can only be called from functions whose target includes those;
+ * - bulk `foo(float *y, const float *x, size_t n)`, callable from any code,
+ *   which picks the widest path for the host CPU at run time and falls back to
+ *   libm. `y` may alias `x`.
+ *
+ * `Accuracy` selects the polynomials: `ACCURATE` is within a few ulp of libm,
+ * `FAST` uses shorter polynomials with a relative error around 1e-5, which is
+ * below the precision of fp16/bf16 results. The bulk forms default to
+ * `defaultAccuracy()`.
+ *
+ * `exp` returns 0 and infinity where the fp32 result underflows or overflows,
+ * and denormal results where they are representable, like libm; `sigmoid`,
+ * `silu`, `tanh` and `gelu` saturate correctly. NaN propagates through every
+ * function.
+ */
+
+namespace device::cpu::math {
+
+enum class Accuracy {
+    ACCURATE,
+    FAST,
+};
+
+/**
+ * `FAST` if the environment variable `INFINIOP_CPU_FAST_MATH` is `1`,
+ * `ACCURATE` otherwise; read once.
+ */
+Accuracy defaultAccuracy();
+
+// y[i] = exp(x[i] * scale + shift)
+void exp(float *y, const float *x, size_t n, float scale = 1.f, float shift = 0.f, Accuracy accuracy = defaultAccuracy());
+// 自然对数，x < 0 时为 NaN
+void log(float *y, const float *x, size_t n, Accuracy accuracy = defaultAccuracy());
+// 1 / (1 + exp(-x))
+void sigmoid(float *y, const float *x, size_t n, Accuracy accuracy = defaultAccuracy());
+void tanh(float *y, const float *x, size_t n, Accuracy accuracy = defaultAccuracy());
+// x * sigmoid(x)
+void silu(float *y, const float *x, size_t n, Accuracy accuracy = defaultAccuracy());
+// GELU 的 tanh 近似：0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+void gelu(float *y, const float *x, size_t n, Accuracy accuracy = defaultAccuracy());
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+#define INFINIOP_CPU_MATH_AVX2 "avx2,fma"
+#define INFINIOP_CPU_MATH_AVX512 "avx512f,avx512dq,avx2,fma"
+
+// ------------------------------------------------------------------ AVX2
+
+// exp 结果有限且不为 0 的参数范围：x 大于上界时 exp(x) 溢出为 inf，小于下界时舍入为 0
+constexpr float EXP_MAX_ARG = 88.72283172607422f;
+constexpr float EXP_MIN_ARG = -103.97207641601562f;
+
+/**
+ * 将 x 分解为 n * ln2 + r（|r| <= ln2 / 2，ln2 拆成两部分以保持精度），
+ * exp(r) = 1 + r + r^2 * q(r)，ACCURATE 用 Cephes 的 4 次 q，FAST 用 2 次 q，
+ * 最后乘以 2^n。2^n 分成 2^(n/2) 与 2^(n - n/2) 两次相乘，结果接近 FLT_MAX 或为非规格化数时
+ * 两个因子都可以直接写入指数位。超出范围的参数最后置为 inf 或 0；
+ * min/max 的操作数顺序使 NaN 得以保留。
+ */
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 expAvx2(__m256 x) {
+    const __m256 over = _mm256_cmp_ps(x, _mm256_set1_ps(EXP_MAX_ARG), _CMP_GT_OQ);
+    const __m256 under = _mm256_cmp_ps(x, _mm256_set1_ps(EXP_MIN_ARG), _CMP_LT_OQ);
+    x = _mm256_min_ps(_mm256_set1_ps(EXP_MAX_ARG), _mm256_max_ps(_mm256_set1_ps(EXP_MIN_ARG), x));
+    __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), r);
+    __m256 q;
+    if constexpr (A == Accuracy::FAST) {
+        q = _mm256_set1_ps(4.1791986e-2f);
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(1.6741899e-1f));
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(5.0000000e-1f));
+    } else {
+        q = _mm256_set1_ps(1.9875691500e-4f);
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(1.3981999507e-3f));
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(8.3334519073e-3f));
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(4.1665795894e-2f));
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(1.6666665459e-1f));
+        q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(5.0000001201e-1f));
+    }
+    __m256 p = _mm256_fmadd_ps(q, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.f)));
+    // n 在 [-150, 128] 内，两半都在 [-75, 64] 内
+    const __m256i ni = _mm256_cvtps_epi32(n);
+    const __m256i n1 = _mm256_srai_epi32(ni, 1);
+    const __m256i n2 = _mm256_sub_epi32(ni, n1);
+    const __m256 s1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23));
+    const __m256 s2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23));
+    p = _mm256_mul_ps(_mm256_mul_ps(p, s1), s2);
+    p = _mm256_blendv_ps(p, _mm256_set1_ps(__builtin_inff()), over);
+    return _mm256_andnot_ps(under, p);
+}
+
+/**
+ * 将 x 分解为 m * 2^e（m 在 [sqrt(0.5), sqrt(2)) 内），t = m - 1，
+ * log(m) = t - t^2 / 2 + t^3 * q(t)，ACCURATE 用 Cephes 的 8 次 q，FAST 用 3 次 q。
+ * 非规格化数先放大 2^23；负数、0、无穷与 NaN 最后单独处理。
+ */
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 logAvx2(__m256 x) {
+    const __m256 invalid = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_NGE_UQ);
+    const __m256 zero = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ);
+    const __m256 inf = _mm256_cmp_ps(x, _mm256_set1_ps(__builtin_inff()), _CMP_EQ_OQ);
+    const __m256 denormal = _mm256_cmp_ps(x, _mm256_set1_ps(1.17549435e-38f), _CMP_LT_OQ);
+    x = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.f)), denormal);
+
+    __m256i bits = _mm256_castps_si256(x);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    e = _mm256_sub_ps(e, _mm256_and_ps(denormal, _mm256_set1_ps(23.f)));
+    // 尾数置于 [0.5, 1)，小于 sqrt(0.5) 时翻倍
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000)));
+    const __m256 low = _mm256_cmp_ps(m, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e = _mm256_sub_ps(e, _mm256_and_ps(low, _mm256_set1_ps(1.f)));
+    __m256 t = _mm256_sub_ps(_mm256_add_ps(m, _mm256_and_ps(low, m)), _mm256_set1_ps(1.f));
+
+    __m256 q;
+    if constexpr (A == Accuracy::FAST) {
+        q = _mm256_set1_ps(-1.4852840e-1f);
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(2.1452892e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-2.5164769e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(3.3314170e-1f));
+    } else {
+        q = _mm256_set1_ps(7.0376836292e-2f);
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-1.1514610310e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(1.1676998740e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-1.2420140846e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(1.4249322787e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-1.6668057665e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(2.0000714765e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(-2.4999993993e-1f));
+        q = _mm256_fmadd_ps(q, t, _mm256_set1_ps(3.3333331174e-1f));
+    }
+    const __m256 z = _mm256_mul_ps(t, t);
+    __m256 y = _mm256_mul_ps(_mm256_mul_ps(q, t), z);
+    y = _mm256_fmadd_ps(e, _mm256_set1_ps(-2.12194440e-4f), y);
+    y = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+    y = _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(t, y));
+
+    y = _mm256_blendv_ps(y, _mm256_set1_ps(__builtin_nanf("")), invalid);
+    y = _mm256_blendv_ps(y, _mm256_set1_ps(-__builtin_inff()), zero);
+    return _mm256_blendv_ps(y, x, inf);
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 sigmoidAvx2(__m256 x) {
+    __m256 e = expAvx2<A>(_mm256_sub_ps(_mm256_setzero_ps(), x));
+    return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_add_ps(_mm256_set1_ps(1.f), e));
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 siluAvx2(__m256 x) {
+    __m256 e = expAvx2<A>(_mm256_sub_ps(_mm256_setzero_ps(), x));
+    return _mm256_div_ps(x, _mm256_add_ps(_mm256_set1_ps(1.f), e));
+}
+
+/**
+ * |x| < 0.625 时用 Cephes 的奇多项式，避免 1 - 2 / (exp(2|x|) + 1) 在 0 附近的相消；
+ * 其余部分由 exp 计算后恢复符号。
+ */
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 tanhAvx2(__m256 x) {
+    const __m256 sign = _mm256_set1_ps(-0.f);
+    const __m256 a = _mm256_andnot_ps(sign, x);
+    __m256 e = expAvx2<A>(_mm256_add_ps(a, a));
+    __m256 large = _mm256_sub_ps(_mm256_set1_ps(1.f), _mm256_div_ps(_mm256_set1_ps(2.f), _mm256_add_ps(e, _mm256_set1_ps(1.f))));
+    large = _mm256_or_ps(large, _mm256_and_ps(sign, x));
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(-5.70498872745e-3f);
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(2.06390887954e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-5.37397155531e-2f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.33314422036e-1f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33332819422e-1f));
+    const __m256 small = _mm256_fmadd_ps(_mm256_mul_ps(p, z), x, x);
+
+    return _mm256_blendv_ps(large, small, _mm256_cmp_ps(a, _mm256_set1_ps(0.625f), _CMP_LT_OQ));
+}
+
+/**
+ * 0.5 * (1 + tanh(u)) = sigmoid(2u)，因此 gelu(x) = x / (1 + exp(t))，t = -2u。
+ * t > 0 时改写为 x * exp(-t) / (1 + exp(-t))，指数的参数总是 -|t|，不会在结果下溢之前先溢出。
+ * x 为较大的负数时结果约为 x * exp(-t)，t 的舍入误差会被放大 |t| 倍（x = -10 时约 90 倍），
+ * 因此 ACCURATE 在 fp64 中计算 t，拆成 fp32 的 hi + lo，再用 exp(-|hi|) * (1 ∓ lo) 补上 lo；
+ * t > 64 时先从 t 中减去 32 ln2、最后再乘以 2^-32，使 exp(-t) 在结果仍为规格化数时不落入非规格化范围。
+ * 实测 ACCURATE 的误差不超过 4 ulp；FAST 直接在 fp32 中计算 t，相对误差约 3e-5（|x| 较大时约数百 ulp）。
+ */
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX2)
+inline __m256 geluAvx2(__m256 x) {
+    const __m256 sign = _mm256_set1_ps(-0.f);
+    __m256 t, lo, scale;
+    if constexpr (A == Accuracy::FAST) {
+        const __m256 z = _mm256_mul_ps(x, x);
+        t = _mm256_mul_ps(x, _mm256_fmadd_ps(z, _mm256_set1_ps(-2.f * 0.7978845608f * 0.044715f), _mm256_set1_ps(-2.f * 0.7978845608f)));
+    } else {
+        __m128 h[2], l[2], s[2];
+        for (int i = 0; i < 2; ++i) {
+            const __m256d xd = _mm256_cvtps_pd(i == 0 ? _mm256_castps256_ps128(x) : _mm256_extractf128_ps(x, 1));
+            __m256d td = _mm256_mul_pd(xd, _mm256_fmadd_pd(_mm256_mul_pd(xd, xd), _mm256_set1_pd(-2. * 0.7978845608028654 * 0.044715), _mm256_set1_pd(-2. * 0.7978845608028654)));
+            const __m256d big = _mm256_cmp_pd(td, _mm256_set1_pd(64.), _CMP_GT_OQ);
+            td = _mm256_sub_pd(td, _mm256_and_pd(big, _mm256_set1_pd(32. * 0.6931471805599453)));
+            h[i] = _mm256_cvtpd_ps(td);
+            l[i] = _mm256_cvtpd_ps(_mm256_sub_pd(td, _mm256_cvtps_pd(h[i])));
+            s[i] = _mm256_cvtpd_ps(_mm256_blendv_pd(_mm256_set1_pd(1.), _mm256_set1_pd(0x1p-32), big));
+        }
+        t = _mm256_set_m128(h[1], h[0]);
+        lo = _mm256_set_m128(l[1], l[0]);
+        scale = _mm256_set_m128(s[1], s[0]);
+    }
+    const __m256 pos = _mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GT_OQ);
+    __m256 e = expAvx2<A>(_mm256_or_ps(t, sign));
+    if constexpr (A == Accuracy::ACCURATE) {
+        // x 为 inf 时 lo 为 NaN，但此时 e 为 0 或 1，结果在下面由 x 决定
+        lo = _mm256_and_ps(lo, _mm256_cmp_ps(lo, lo, _CMP_ORD_Q));
+        e = _mm256_fmadd_ps(e, _mm256_xor_ps(lo, _mm256_and_ps(pos, sign)), e);
+    }
+    const __m256 num = _mm256_blendv_ps(_mm256_set1_ps(1.f), e, pos);
+    __m256 y = _mm256_div_ps(_mm256_mul_ps(x, num), _mm256_add_ps(_mm256_set1_ps(1.f), e));
+    if constexpr (A == Accuracy::ACCURATE) {
+        // 缩放时 e < 2^-60，分母恰为 1，只在这一步舍入到非规格化数
+        y = _mm256_mul_ps(y, scale);
+    }
+    return y;
+}
+
+// ---------------------------------------------------------------- AVX-512
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 expAvx512(__m512 x) {
+    const __mmask16 over = _mm512_cmp_ps_mask(x, _mm512_set1_ps(EXP_MAX_ARG), _CMP_GT_OQ);
+    const __mmask16 under = _mm512_cmp_ps_mask(x, _mm512_set1_ps(EXP_MIN_ARG), _CMP_LT_OQ);
+    x = _mm512_min_ps(_mm512_set1_ps(EXP_MAX_ARG), _mm512_max_ps(_mm512_set1_ps(EXP_MIN_ARG), x));
+    __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), r);
+    __m512 q;
+    if constexpr (A == Accuracy::FAST) {
+        q = _mm512_set1_ps(4.1791986e-2f);
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(1.6741899e-1f));
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(5.0000000e-1f));
+    } else {
+        q = _mm512_set1_ps(1.9875691500e-4f);
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(1.3981999507e-3f));
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(8.3334519073e-3f));
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(4.1665795894e-2f));
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(1.6666665459e-1f));
+        q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(5.0000001201e-1f));
+    }
+    __m512 p = _mm512_fmadd_ps(q, _mm512_mul_ps(r, r), _mm512_add_ps(r, _mm512_set1_ps(1.f)));
+    // scalef 计算 p * 2^n，结果为非规格化数时只舍入一次
+    p = _mm512_scalef_ps(p, n);
+    p = _mm512_mask_mov_ps(p, over, _mm512_set1_ps(__builtin_inff()));
+    return _mm512_mask_mov_ps(p, under, _mm512_setzero_ps());
+}
+
+// getexp/getmant 直接处理非规格化数
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 logAvx512(__m512 x) {
+    const __mmask16 invalid = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_NGE_UQ);
+    const __mmask16 zero = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_EQ_OQ);
+    const __mmask16 inf = _mm512_cmp_ps_mask(x, _mm512_set1_ps(__builtin_inff()), _CMP_EQ_OQ);
+
+    __m512 e = _mm512_add_ps(_mm512_getexp_ps(x), _mm512_set1_ps(1.f));
+    __m512 m = _mm512_getmant_ps(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_zero);
+    const __mmask16 low = _mm512_cmp_ps_mask(m, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e = _mm512_mask_sub_ps(e, low, e, _mm512_set1_ps(1.f));
+    __m512 t = _mm512_sub_ps(_mm512_mask_add_ps(m, low, m, m), _mm512_set1_ps(1.f));
+
+    __m512 q;
+    if constexpr (A == Accuracy::FAST) {
+        q = _mm512_set1_ps(-1.4852840e-1f);
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(2.1452892e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(-2.5164769e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(3.3314170e-1f));
+    } else {
+        q = _mm512_set1_ps(7.0376836292e-2f);
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(-1.1514610310e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(1.1676998740e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(-1.2420140846e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(1.4249322787e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(-1.6668057665e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(2.0000714765e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(-2.4999993993e-1f));
+        q = _mm512_fmadd_ps(q, t, _mm512_set1_ps(3.3333331174e-1f));
+    }
+    const __m512 z = _mm512_mul_ps(t, t);
+    __m512 y = _mm512_mul_ps(_mm512_mul_ps(q, t), z);
+    y = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), y);
+    y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    y = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), _mm512_add_ps(t, y));
+
+    y = _mm512_mask_mov_ps(y, invalid, _mm512_set1_ps(__builtin_nanf("")));
+    y = _mm512_mask_mov_ps(y, zero, _mm512_set1_ps(-__builtin_inff()));
+    return _mm512_mask_mov_ps(y, inf, x);
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 sigmoidAvx512(__m512 x) {
+    __m512 e = expAvx512<A>(_mm512_sub_ps(_mm512_setzero_ps(), x));
+    return _mm512_div_ps(_mm512_set1_ps(1.f), _mm512_add_ps(_mm512_set1_ps(1.f), e));
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 siluAvx512(__m512 x) {
+    __m512 e = expAvx512<A>(_mm512_sub_ps(_mm512_setzero_ps(), x));
+    return _mm512_div_ps(x, _mm512_add_ps(_mm512_set1_ps(1.f), e));
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 tanhAvx512(__m512 x) {
+    const __m512 a = _mm512_abs_ps(x);
+    __m512 e = expAvx512<A>(_mm512_add_ps(a, a));
+    __m512 large = _mm512_sub_ps(_mm512_set1_ps(1.f), _mm512_div_ps(_mm512_set1_ps(2.f), _mm512_add_ps(e, _mm512_set1_ps(1.f))));
+    large = _mm512_or_ps(large, _mm512_and_ps(_mm512_set1_ps(-0.f), x));
+
+    const __m512 z = _mm512_mul_ps(x, x);
+    __m512 p = _mm512_set1_ps(-5.70498872745e-3f);
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(2.06390887954e-2f));
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(-5.37397155531e-2f));
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(1.33314422036e-1f));
+    p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(-3.33332819422e-1f));
+    const __m512 small = _mm512_fmadd_ps(_mm512_mul_ps(p, z), x, x);
+
+    return _mm512_mask_mov_ps(large, _mm512_cmp_ps_mask(a, _mm512_set1_ps(0.625f), _CMP_LT_OQ), small);
+}
+
+template <Accuracy A = Accuracy::ACCURATE>
+INFINIOP_CPU_TARGET(INFINIOP_CPU_MATH_AVX512)
+inline __m512 geluAvx512(__m512 x) {
+    const __m512 sign = _mm512_set1_ps(-0.f);
+    __m512 t, lo, scale;
+    if constexpr (A == Accuracy::FAST) {
+        const __m512 z = _mm512_mul_ps(x, x);
+        t = _mm512_mul_ps(x, _mm512_fmadd_ps(z, _mm512_set1_ps(-2.f * 0.7978845608f * 0.044715f), _mm512_set1_ps(-2.f * 0.7978845608f)));
+    } else {
+        __m256 h[2], l[2], s[2];
+        for (int i = 0; i < 2; ++i) {
+            const __m512d xd = _mm512_cvtps_pd(i == 0 ? _mm512_castps512_ps256(x) : _mm512_extractf32x8_ps(x, 1));
+            __m512d td = _mm512_mul_pd(xd, _mm512_fmadd_pd(_mm512_mul_pd(xd, xd), _mm512_set1_pd(-2. * 0.7978845608028654 * 0.044715), _mm512_set1_pd(-2. * 0.7978845608028654)));
+            const __mmask8 big = _mm512_cmp_pd_mask(td, _mm512_set1_pd(64.), _CMP_GT_OQ);
+            td = _mm512_mask_sub_pd(td, big, td, _mm512_set1_pd(32. * 0.6931471805599453));
+            h[i] = _mm512_cvtpd_ps(td);
+            l[i] = _mm512_cvtpd_ps(_mm512_sub_pd(td, _mm512_cvtps_pd(h[i])));
+            s[i] = _mm512_cvtpd_ps(_mm512_mask_mov_pd(_mm512_set1_pd(1.), big, _mm512_set1_pd(0x1p-32)));
+        }
+        t = _mm512_insertf32x8(_mm512_castps256_ps512(h[0]), h[1], 1);
+        lo = _mm512_insertf32x8(_mm512_castps256_ps512(l[0]), l[1], 1);
+        scale = _mm512_insertf32x8(_mm512_castps256_ps512(s[0]), s[1], 1);
+    }
+    const __mmask16 pos = _mm512_cmp_ps_mask(t, _mm512_setzero_ps(), _CMP_GT_OQ);
+    __m512 e = expAvx512<A>(_mm512_or_ps(t, sign));
+    if constexpr (A == Accuracy::ACCURATE) {
+        lo = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(lo, lo, _CMP_ORD_Q), lo);
+        e = _mm512_fmadd_ps(e, _mm512_mask_xor_ps(lo, pos, lo, sign), e);
+    }
+    const __m512 num = _mm512_mask_mov_ps(_mm512_set1_ps(1.f), pos, e);
+    __m512 y = _mm512_div_ps(_mm512_mul_ps(x, num), _mm512_add_ps(_mm512_set1_ps(1.f), e));
+    if constexpr (A == Accuracy::ACCURATE) {
+        y = _mm512_mul_ps(y, scale);
+    }
+    return y;
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+} // namespace device::cpu::math
+
+#endif // __INFINIOP_CPU_MATH_H__
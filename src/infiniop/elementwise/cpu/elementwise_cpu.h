@@ -3,6 +3,7 @@
 
 #include "../../devices/cpu/common_cpu.h"
 #include "../elementwise.h"
+#include "elementwise_cpu_simd.h"
 #include <utility>
 
 /**
@@ -105,6 +106,97 @@ utils::Result<DeviceImpl> DeviceImpl::create(Args &&...args) {
     return INFINI_STATUS_NOT_IMPLEMENTED;
 }
 
+/**
+ * @brief Splits `[0, size)` into one contiguous range per OpenMP thread.
+ *
+ * Must be called inside a parallel region; returns the range of the calling thread.
+ */
+inline std::pair<size_t, size_t> threadRange(size_t size) {
+#ifdef ENABLE_OMP
+    const size_t threads = size_t(omp_get_num_threads());
+    const size_t tid = size_t(omp_get_thread_num());
+#else
+    const size_t threads = 1, tid = 0;
+#endif
+    return {size * tid / threads, size * (tid + 1) / threads};
+}
+
+/**
+ * @brief Walks the flat output indices `[begin, end)` one innermost row at a time.
+ *
+ * The coordinates of `begin` are decomposed once; afterwards the offsets of the
+ * output and of the `N` inputs advance with an odometer-style carry, so no
+ * division is performed per element. For every run of elements along the
+ * innermost dimension, `fn(len, offsets, strides)` is called, where index 0 of
+ * `offsets`/`strides` refers to the output and index `i + 1` to input `i`.
+ * Strides are in elements; broadcast dimensions of an input have stride 0.
+ *
+ * When all tensors are contiguous the whole range is a single run.
+ */
+template <size_t N, typename Fn>
+void walkRange(const op::elementwise::ElementwiseInfo &info, size_t begin, size_t end, Fn &&fn) {
+    using Offsets = std::array<ptrdiff_t, N + 1>;
+    if (begin >= end) {
+        return;
+    }
+    const size_t ndim = info.getNdim();
+    bool flat = info.isOutputContiguous();
+    for (size_t k = 0; k < N; ++k) {
+        flat = flat && info.getInputContiguous()[k];
+    }
+    if (flat || ndim == 0) {
+        Offsets offsets, strides;
+        offsets.fill(ptrdiff_t(begin));
+        strides.fill(1);
+        fn(end - begin, offsets, strides);
+        return;
+    }
+
+    // strides[k] 是第 k 个张量（0 为输出）各维的步长
+    const size_t *shape = info.getOutputShape();
+    std::array<const ptrdiff_t *, N + 1> strides;
+    strides[0] = info.getOutputStrides();
+    for (size_t k = 0; k < N; ++k) {
+        strides[k + 1] = info.getInputStrides(k);
+    }
+
+    // 只在起点做一次下标分解
+    std::vector<size_t> coord(ndim);
+    Offsets offsets{}, inner_strides;
+    for (size_t d = ndim, rem = begin; d-- > 0;) {
+        coord[d] = rem % shape[d];
+        rem /= shape[d];
+        for (size_t k = 0; k <= N; ++k) {
+            offsets[k] += ptrdiff_t(coord[d]) * strides[k][d];
+        }
+    }
+    for (size_t k = 0; k <= N; ++k) {
+        inner_strides[k] = strides[k][ndim - 1];
+    }
+
+    const size_t last = ndim - 1;
+    for (size_t i = begin;;) {
+        const size_t len = std::min(shape[last] - coord[last], end - i);
+        fn(len, offsets, inner_strides);
+        i += len;
+        if (i >= end) {
+            break;
+        }
+        // 最内维走到末尾，逐维进位
+        for (size_t k = 0; k <= N; ++k) {
+            offsets[k] += ptrdiff_t(len) * inner_strides[k];
+        }
+        coord[last] += len;
+        for (size_t d = last; d > 0 && coord[d] == shape[d]; --d) {
+            coord[d] = 0;
+            ++coord[d - 1];
+            for (size_t k = 0; k <= N; ++k) {
+                offsets[k] += strides[k][d - 1] - ptrdiff_t(shape[d]) * strides[k][d];
+            }
+        }
+    }
+}
+
 // Perform elementwise operation for different input types
 template <typename Op, typename Tout, typename... Tin, size_t... Is, typename... Args,
           std::enable_if_t<(sizeof...(Tin) == Op::num_inputs), int> = 0>
@@ -116,24 +208,28 @@ void calculate_impl(const op::elementwise::ElementwiseInfo &info,
 
     Tout *out = reinterpret_cast<Tout *>(output);
     std::tuple<const Tin *...> input_ptrs = {reinterpret_cast<const Tin *>(inputs[Is])...};
-    ptrdiff_t output_size = info.getOutputSize();
-
-#pragma omp parallel for
-    for (ptrdiff_t i = 0; i < output_size; ++i) {
-        size_t out_idx = info.isOutputContiguous()
-                           ? i
-                           : op::common_cpu::indexToOffset(i, info.getNdim(), info.getOutputShape(), info.getOutputStrides());
-
-        auto get_input_idx = [&](size_t input_id) {
-            return info.getInputContiguous()[input_id]
-                     ? i
-                     : (info.getInputBroadcasted()[input_id]
-                            ? op::common_cpu::indexToReducedOffset(i, info.getNdim(), info.getOutputStrides(), info.getInputStrides(input_id))
-                            : op::common_cpu::indexToOffset(i, info.getNdim(), info.getInputShape(input_id), info.getInputStrides(input_id)));
-        };
-
-        out[out_idx] = utils::cast<Tout>(
-            Op{}.template operator()<Tout, Tin...>(std::get<Is>(input_ptrs)[get_input_idx(Is)]..., std::forward<Args>(args)...));
+    const size_t output_size = info.getOutputSize();
+    constexpr size_t N = sizeof...(Tin);
+
+#pragma omp parallel
+    {
+        auto [begin, end] = threadRange(output_size);
+        walkRange<N>(info, begin, end, [&](size_t len, const std::array<ptrdiff_t, N + 1> &offsets, const std::array<ptrdiff_t, N + 1> &strides) {
+            Tout *out_ = out + offsets[0];
+            std::tuple<const Tin *...> ins = {std::get<Is>(input_ptrs) + offsets[Is + 1]...};
+            const bool unit = ((strides[0] == 1) && ... && (strides[Is + 1] == 1));
+            if (unit) {
+                for (size_t j = 0; j < len; ++j) {
+                    out_[j] = utils::cast<Tout>(
+                        Op{}.template operator()<Tout, Tin...>(std::get<Is>(ins)[j]..., std::forward<Args>(args)...));
+                }
+            } else {
+                for (size_t j = 0; j < len; ++j) {
+                    out_[ptrdiff_t(j) * strides[0]] = utils::cast<Tout>(
+                        Op{}.template operator()<Tout, Tin...>(std::get<Is>(ins)[ptrdiff_t(j) * strides[Is + 1]]..., std::forward<Args>(args)...));
+                }
+            }
+        });
     }
 }
 
@@ -160,27 +256,42 @@ void calculate_impl(const op::elementwise::ElementwiseInfo &info,
 
     Tdata *out = reinterpret_cast<Tdata *>(output);
     std::array<const Tdata *, sizeof...(Is)> ins = {reinterpret_cast<const Tdata *>(inputs[Is])...};
-    const ptrdiff_t output_size = info.getOutputSize();
-
-#pragma omp parallel for
-    for (ptrdiff_t i = 0; i < output_size; ++i) {
-        size_t out_idx = info.isOutputContiguous()
-                           ? i
-                           : op::common_cpu::indexToOffset(i, info.getNdim(), info.getOutputShape(), info.getOutputStrides());
-
-        auto get_input_idx = [&](size_t input_id) {
-            return info.getInputContiguous()[input_id]
-                     ? i
-                     : (info.getInputBroadcasted()[input_id]
-                            ? op::common_cpu::indexToReducedOffset(i, info.getNdim(), info.getOutputStrides(), info.getInputStrides(input_id))
-                            : op::common_cpu::indexToOffset(i, info.getNdim(), info.getInputShape(input_id), info.getInputStrides(input_id)));
-        };
+    const size_t output_size = info.getOutputSize();
+    constexpr size_t N = sizeof...(Is);
 
+    auto compute = [&](const auto &...x) {
         if constexpr (std::is_same_v<Tdata, fp16_t> || std::is_same_v<Tdata, bf16_t>) {
-            out[out_idx] = utils::cast<Tdata>(Op{}(utils::cast<float>(ins[Is][get_input_idx(Is)])..., std::forward<Args>(args)...));
+            return utils::cast<Tdata>(Op{}(utils::cast<float>(x)..., std::forward<Args>(args)...));
         } else {
-            out[out_idx] = Op{}(ins[Is][get_input_idx(Is)]..., std::forward<Args>(args)...);
+            return Op{}(x..., std::forward<Args>(args)...);
         }
+    };
+
+#pragma omp parallel
+    {
+        auto [begin, end] = threadRange(output_size);
+        walkRange<N>(info, begin, end, [&](size_t len, const std::array<ptrdiff_t, N + 1> &offsets, const std::array<ptrdiff_t, N + 1> &strides) {
+            Tdata *out_ = out + offsets[0];
+            const std::array<const Tdata *, N> ins_ = {(ins[Is] + offsets[Is + 1])...};
+            const bool unit = ((strides[0] == 1) && ... && (strides[Is + 1] == 1));
+            // 输出连续、输入连续或沿最内维广播时，优先使用算子的向量形式
+            if constexpr (sizeof...(Args) == 0) {
+                const bool vector = ((strides[0] == 1) && ... && (strides[Is + 1] == 0 || strides[Is + 1] == 1));
+                if (vector && simd::run<Op, Tdata, N>(out_, ins_.data(), strides.data() + 1, len, compute)) {
+                    return;
+                }
+            }
+            if (unit) {
+                // 最内维全部连续，编译器可以向量化
+                for (size_t j = 0; j < len; ++j) {
+                    out_[j] = compute(ins_[Is][j]...);
+                }
+            } else {
+                for (size_t j = 0; j < len; ++j) {
+                    out_[ptrdiff_t(j) * strides[0]] = compute(ins_[Is][ptrdiff_t(j) * strides[Is + 1]]...);
+                }
+            }
+        });
     }
 }
 
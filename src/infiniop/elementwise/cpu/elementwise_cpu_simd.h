@@ -0,0 +1,213 @@
+#ifndef __INFINIOP_ELEMENTWISE_CPU_SIMD_H__
+#define __INFINIOP_ELEMENTWISE_CPU_SIMD_H__
+
+#include "../../devices/cpu/common_cpu.h"
+#include "../../devices/cpu/cpu_isa.h"
+#include <type_traits>
+#include <utility>
+
+/**
+ * Explicitly vectorized kernels for contiguous elementwise runs.
+ *
+ * An elementwise `Op` opts in by adding overloads of `operator()` that take and
+ * return `__m256` (8 fp32 lanes) and/or `__m512` (16 fp32 lanes) by value,
+ * marked with `INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)` or
+ * `INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)` respectively. fp16/bf16
+ * data is widened to fp32 on load and narrowed back on store, a whole vector at
+ * a time. Ops without a vector form keep the scalar loop.
+ *
+ * The output is contiguous; every input is either contiguous too or broadcast
+ * along the run (stride 0), in which case its single value is converted once
+ * and kept in a register. After `ElementwiseInfo` has coalesced the layout this
+ * covers the common broadcasts: a bias row (`[m, n] + [n]`), a per-row scale
+ * (`[m, n] * [m, 1]`) and a scalar operand.
+ */
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// F16C 随 AVX2 一同要求，以便在寄存器中转换 fp16
+#define INFINIOP_ELEMENTWISE_AVX2 "avx2,fma,f16c"
+#define INFINIOP_ELEMENTWISE_AVX512 "avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c"
+
+namespace op::elementwise::cpu::simd {
+
+// 向量类型按位宽给出：带有向量属性的类型作为模板实参时 GCC 会报 -Wignored-attributes
+template <size_t Bits>
+struct VectorOf;
+
+template <>
+struct VectorOf<256> {
+    using type = __m256;
+};
+
+template <>
+struct VectorOf<512> {
+    using type = __m512;
+};
+
+template <size_t Bits, size_t>
+using Repeat = typename VectorOf<Bits>::type;
+
+/**
+ * Whether `Op` has a non-template `V operator()(V...) const` taking `N` vectors
+ * of `Bits` bits.
+ *
+ * The scalar `operator()` of the ops is a template over `const T &`, which would
+ * also accept vector types through GCC's vector extensions; taking the address
+ * with the exact by-value signature only matches a dedicated overload.
+ */
+template <typename Op, size_t Bits, typename Seq, typename = void>
+struct HasVectorForm : std::false_type {};
+
+template <typename Op, size_t Bits, size_t... Is>
+struct HasVectorForm<Op, Bits, std::index_sequence<Is...>,
+                     decltype(void(static_cast<Repeat<Bits, 0> (Op::*)(Repeat<Bits, Is>...) const>(&Op::operator())))>
+    : std::true_type {};
+
+template <typename Op, size_t Bits, size_t N>
+constexpr bool hasVectorForm = HasVectorForm<Op, Bits, std::make_index_sequence<N>>::value;
+
+template <typename Tdata>
+constexpr bool isVectorType = std::is_same_v<Tdata, float> || std::is_same_v<Tdata, fp16_t> || std::is_same_v<Tdata, bf16_t>;
+
+// ------------------------------------------------------------------ AVX2
+
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline __m256 loadAvx2(const Tdata *src) {
+    if constexpr (std::is_same_v<Tdata, float>) {
+        return _mm256_loadu_ps(src);
+    } else if constexpr (std::is_same_v<Tdata, fp16_t>) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+    } else {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+    }
+}
+
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline void storeAvx2(Tdata *dst, __m256 v) {
+    if constexpr (std::is_same_v<Tdata, float>) {
+        _mm256_storeu_ps(dst, v);
+    } else if constexpr (std::is_same_v<Tdata, fp16_t>) {
+        __m128i h = _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), h);
+    } else {
+        // 与 _f32_to_bf16 相同：加 0x7fff 与保留位最低位后截断，NaN 置静默位而不是进位
+        __m256i x = _mm256_castps_si256(v);
+        __m256i bias = _mm256_add_epi32(_mm256_set1_epi32(0x7fff), _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1)));
+        __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+        x = _mm256_srli_epi32(_mm256_blendv_epi8(_mm256_add_epi32(x, bias), _mm256_or_si256(x, _mm256_set1_epi32(0x00400000)), nan), 16);
+        __m128i h = _mm_packus_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), h);
+    }
+}
+
+/**
+ * `out[j] = Op(ins[0][j * strides[0]], ...)` for `j < len`, where every input
+ * stride is 0 or 1. The tail shorter than a vector goes through `scalar`.
+ */
+template <typename Op, typename Tdata, typename Scalar, size_t... Is>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+void runAvx2(Tdata *out, const Tdata *const *ins, const ptrdiff_t *strides, size_t len, const Scalar &scalar, std::index_sequence<Is...>) {
+    const Op op{};
+    // 广播的输入只转换一次
+    const __m256 bcast[] = {_mm256_set1_ps(utils::cast<float>(ins[Is][0]))...};
+    size_t j = 0;
+    for (; j + 8 <= len; j += 8) {
+        storeAvx2(out + j, op((strides[Is] ? loadAvx2(ins[Is] + j) : bcast[Is])...));
+    }
+    for (; j < len; ++j) {
+        out[j] = scalar(ins[Is][ptrdiff_t(j) * strides[Is]]...);
+    }
+}
+
+// ---------------------------------------------------------------- AVX-512
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+inline __m512 loadAvx512(const Tdata *src, __mmask16 mask) {
+    if constexpr (std::is_same_v<Tdata, float>) {
+        return _mm512_maskz_loadu_ps(mask, src);
+    } else if constexpr (std::is_same_v<Tdata, fp16_t>) {
+        return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, src));
+    } else {
+        __m256i h = _mm256_maskz_loadu_epi16(mask, src);
+        return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+    }
+}
+
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+inline void storeAvx512(Tdata *dst, __m512 v, __mmask16 mask) {
+    if constexpr (std::is_same_v<Tdata, float>) {
+        _mm512_mask_storeu_ps(dst, mask, v);
+    } else if constexpr (std::is_same_v<Tdata, fp16_t>) {
+        _mm256_mask_storeu_epi16(dst, mask, _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    } else {
+        __m512i x = _mm512_castps_si512(v);
+        __m512i bias = _mm512_add_epi32(_mm512_set1_epi32(0x7fff), _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1)));
+        __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(x, _mm512_set1_epi32(0x7fffffff)), _mm512_set1_epi32(0x7f800000));
+        x = _mm512_srli_epi32(_mm512_mask_mov_epi32(_mm512_add_epi32(x, bias), nan, _mm512_or_si512(x, _mm512_set1_epi32(0x00400000))), 16);
+        _mm256_mask_storeu_epi16(dst, mask, _mm512_cvtepi32_epi16(x));
+    }
+}
+
+// 与 runAvx2 相同，尾部用掩码加载与存储，不需要标量循环
+template <typename Op, typename Tdata, size_t... Is>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+void runAvx512(Tdata *out, const Tdata *const *ins, const ptrdiff_t *strides, size_t len, std::index_sequence<Is...>) {
+    const Op op{};
+    const __m512 bcast[] = {_mm512_set1_ps(utils::cast<float>(ins[Is][0]))...};
+    size_t j = 0;
+    for (; j + 16 <= len; j += 16) {
+        storeAvx512(out + j, op((strides[Is] ? loadAvx512(ins[Is] + j, __mmask16(0xffff)) : bcast[Is])...), __mmask16(0xffff));
+    }
+    if (j < len) {
+        const __mmask16 mask = __mmask16((1u << (len - j)) - 1);
+        storeAvx512(out + j, op((strides[Is] ? loadAvx512(ins[Is] + j, mask) : bcast[Is])...), mask);
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+} // namespace op::elementwise::cpu::simd
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+namespace op::elementwise::cpu::simd {
+
+/**
+ * Runs `Op` over `len` contiguous output elements with the widest vector form
+ * it has for the host CPU. `strides[i]` is the stride of input `i` along the
+ * run and must be 0 or 1. Returns false, doing nothing, if there is no vector
+ * form; the caller then falls back to `scalar`.
+ */
+template <typename Op, typename Tdata, size_t N, typename Scalar>
+bool run(Tdata *out, const Tdata *const *ins, const ptrdiff_t *strides, size_t len, const Scalar &scalar) {
+#ifdef INFINIOP_CPU_X86_SIMD
+    if constexpr (isVectorType<Tdata>) {
+        const auto &isa = device::cpu::isa();
+        if constexpr (hasVectorForm<Op, 512, N>) {
+            if (isa.avx512 && isa.f16c) {
+                runAvx512<Op>(out, ins, strides, len, std::make_index_sequence<N>{});
+                return true;
+            }
+        }
+        if constexpr (hasVectorForm<Op, 256, N>) {
+            if (isa.avx2 && isa.f16c) {
+                runAvx2<Op>(out, ins, strides, len, scalar, std::make_index_sequence<N>{});
+                return true;
+            }
+        }
+    }
+#endif
+    return false;
+}
+
+} // namespace op::elementwise::cpu::simd
+
+#endif // __INFINIOP_ELEMENTWISE_CPU_SIMD_H__
@@ -134,6 +134,74 @@ public:
         return reinterpret_cast<const bool *>(getInputContiguous() + _input_size);
     }
 
+    /**
+     * @brief Compute the coalesced layout shared by the output and all inputs.
+     *
+     * Input strides are aligned to the output shape: inputs with fewer dims are
+     * right-aligned and size-1 dims of an input broadcast with stride 0. Dims of
+     * size 1 in the output are then dropped, and adjacent dims are merged when
+     * they are contiguous with each other in the output and in every input, as
+     * `utils::RearrangeMeta::create` does for rearrange. Unlike there, dims are
+     * never reordered, so flat output indices keep their meaning.
+     *
+     * The result has at least one dim.
+     *
+     * @param output_desc Descriptor of the output tensor.
+     * @param input_descs Descriptors of the input tensors.
+     * @param shape       Receives the coalesced shape.
+     * @param strides     Receives the strides of the output (index 0) and of each input (index i + 1).
+     */
+    static void coalesceDims(
+        infiniopTensorDescriptor_t output_desc,
+        const std::vector<infiniopTensorDescriptor_t> &input_descs,
+        std::vector<size_t> &shape,
+        std::vector<std::vector<ptrdiff_t>> &strides) {
+        const size_t ndim = output_desc->ndim();
+        const size_t count = strides.size();
+        shape.clear();
+        for (auto &tensor_strides : strides) {
+            tensor_strides.clear();
+        }
+
+        if (output_desc->numel() == 0) {
+            shape.push_back(0);
+        }
+        for (size_t d = 0; d < ndim && output_desc->numel() != 0; ++d) {
+            if (output_desc->dim(d) == 1) {
+                continue;
+            }
+            shape.push_back(output_desc->dim(d));
+            strides[0].push_back(output_desc->stride(d));
+            for (size_t i = 0; i + 1 < count; ++i) {
+                const auto &desc = input_descs[i];
+                const size_t offset = ndim - std::min(ndim, desc->ndim());
+                const bool broadcast = d < offset || desc->dim(d - offset) == 1;
+                strides[i + 1].push_back(broadcast ? 0 : desc->stride(d - offset));
+            }
+        }
+        if (shape.empty()) {
+            shape.push_back(1);
+        }
+        for (auto &tensor_strides : strides) {
+            tensor_strides.resize(shape.size(), 1);
+        }
+
+        // Merge dim d - 1 into dim d when every tensor steps over dim d exactly once per step of dim d - 1
+        for (size_t d = shape.size(); d-- > 1;) {
+            const bool mergeable = std::all_of(strides.begin(), strides.end(), [&](const auto &tensor_strides) {
+                return tensor_strides[d - 1] == tensor_strides[d] * ptrdiff_t(shape[d]);
+            });
+            if (mergeable) {
+                shape[d - 1] *= shape[d];
+                shape.erase(shape.begin() + d);
+                for (auto &tensor_strides : strides) {
+                    tensor_strides[d - 1] = tensor_strides[d];
+                    tensor_strides.erase(tensor_strides.begin() + d);
+                }
+            }
+        }
+    }
+
     using ResultType = utils::Result<ElementwiseInfo>;
 
     /**
@@ -157,23 +225,34 @@ public:
         }
 
         auto input_size = input_descs.size();
-        auto ndim = output_desc->ndim();
         auto output_size = output_desc->numel();
-        auto output_contiguous = output_desc->isContiguous();
+
+        // Coalesced shape, and strides of the output (index 0) and of every input (index i + 1)
+        std::vector<size_t> shape;
+        std::vector<std::vector<ptrdiff_t>> strides(input_size + 1);
+        coalesceDims(output_desc, input_descs, shape, strides);
+        const size_t ndim = shape.size();
+
+        auto is_contiguous = [&](const std::vector<ptrdiff_t> &tensor_strides) {
+            ptrdiff_t expected = 1;
+            for (size_t d = ndim; d-- > 0;) {
+                if (tensor_strides[d] != expected) {
+                    return false;
+                }
+                expected *= ptrdiff_t(shape[d]);
+            }
+            return true;
+        };
+        auto output_contiguous = is_contiguous(strides[0]);
 
         // Allocate memory for meta
-        auto shape_unit = output_desc->dim(0);
-        auto stride_unit = output_desc->stride(0);
-        size_t meta_mem_size = ndim * (sizeof(shape_unit) + sizeof(stride_unit))
-                             + input_size * ndim * sizeof(shape_unit)
-                             + input_size * ndim * sizeof(stride_unit)
+        size_t meta_mem_size = ndim * (sizeof(size_t) + sizeof(ptrdiff_t))
+                             + input_size * ndim * sizeof(size_t)
+                             + input_size * ndim * sizeof(ptrdiff_t)
                              + 2 * input_size * sizeof(bool);
         std::vector<size_t> meta(CEIL_DIV(meta_mem_size, sizeof(size_t)));
         int8_t *meta_ptr = reinterpret_cast<int8_t *>(meta.data());
 
-        const auto output_shape = output_desc->shape();
-        const auto output_strides = output_desc->strides();
-
         // Pointers to the sections within _meta
         size_t *output_shape_p = reinterpret_cast<size_t *>(meta_ptr);
         ptrdiff_t *output_strides_p = reinterpret_cast<ptrdiff_t *>(output_shape_p + ndim);
@@ -183,18 +262,16 @@ public:
         bool *input_broadcasted = input_contiguous + input_size;
 
         // Copy output shape and strides
-        std::memcpy(output_shape_p, output_shape.data(), ndim * sizeof(*output_shape_p));
-        std::memcpy(output_strides_p, output_strides.data(), ndim * sizeof(*output_strides_p));
+        std::memcpy(output_shape_p, shape.data(), ndim * sizeof(*output_shape_p));
+        std::memcpy(output_strides_p, strides[0].data(), ndim * sizeof(*output_strides_p));
 
-        // Copy input shapes, strides, contiguous, and broadcasted flags
+        // Copy input shapes (all equal to the output shape after coalescing), strides, contiguous, and broadcasted flags
         for (size_t i = 0; i < input_size; ++i) {
-            auto &desc = input_descs[i];
-            const auto in_shape = desc->shape();
-            const auto in_strides = desc->strides();
-            std::memcpy(input_shapes + i * ndim, in_shape.data(), ndim * sizeof(*input_shapes));
+            const auto &in_strides = strides[i + 1];
+            std::memcpy(input_shapes + i * ndim, shape.data(), ndim * sizeof(*input_shapes));
             std::memcpy(input_strides + i * ndim, in_strides.data(), ndim * sizeof(*input_strides));
-            input_contiguous[i] = desc->isContiguous();
-            input_broadcasted[i] = !input_contiguous[i] && (desc->ndim() != ndim || desc->hasBroadcastDim());
+            input_contiguous[i] = is_contiguous(in_strides);
+            input_broadcasted[i] = !input_contiguous[i] && std::find(in_strides.begin(), in_strides.end(), 0) != in_strides.end();
         }
 
         ElementwiseInfo info(std::move(meta), output_size, input_size, ndim, output_contiguous);
@@ -13,6 +13,16 @@ public:
     T operator()(const T &a, const T &b) const {
         return a + b;
     }
+#ifdef INFINIOP_CPU_X86_SIMD
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+    __m256 operator()(__m256 a, __m256 b) const {
+        return _mm256_add_ps(a, b);
+    }
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+    __m512 operator()(__m512 a, __m512 b) const {
+        return _mm512_add_ps(a, b);
+    }
+#endif
 } AddOp;
 } // namespace op::add::cpu
 
@@ -0,0 +1,49 @@
+#ifndef __ADD_RMS_NORM_H__
+#define __ADD_RMS_NORM_H__
+
+#include "../../operator.h"
+#include "info.h"
+
+#define DESCRIPTOR(NAMESPACE)                                    \
+                                                                 \
+    namespace op::add_rms_norm::NAMESPACE {                      \
+    class Descriptor final : public InfiniopDescriptor {         \
+        AddRMSNormInfo _info;                                    \
+        size_t _workspace_size;                                  \
+                                                                 \
+        Descriptor(                                              \
+            AddRMSNormInfo info,                                 \
+            size_t workspace_size,                               \
+            infiniDevice_t device_type,                          \
+            int device_id)                                       \
+            : InfiniopDescriptor{device_type, device_id},        \
+              _info(std::move(info)),                            \
+              _workspace_size(workspace_size) {}                 \
+                                                                 \
+    public:                                                      \
+        ~Descriptor();                                           \
+                                                                 \
+        size_t workspaceSize() const { return _workspace_size; } \
+                                                                 \
+        static infiniStatus_t create(                            \
+            infiniopHandle_t handle,                             \
+            Descriptor **desc_ptr,                               \
+            infiniopTensorDescriptor_t y_desc,                   \
+            infiniopTensorDescriptor_t residual_out_desc,        \
+            infiniopTensorDescriptor_t x_desc,                   \
+            infiniopTensorDescriptor_t residual_desc,            \
+            infiniopTensorDescriptor_t w_desc,                   \
+            float epsilon);                                      \
+                                                                 \
+        infiniStatus_t calculate(                                \
+            void *workspace, size_t workspace_size,              \
+            void *y,                                             \
+            void *residual_out,                                  \
+            const void *x,                                       \
+            const void *residual,                                \
+            const void *w,                                       \
+            void *stream) const;                                 \
+    };                                                           \
+    }
+
+#endif // __ADD_RMS_NORM_H__
@@ -0,0 +1,131 @@
+#include "add_rms_norm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../reduce/cpu/reduce.h"
+
+namespace op::add_rms_norm::cpu {
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t residual_out_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t residual_desc,
+    infiniopTensorDescriptor_t w_desc,
+    float epsilon) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = AddRMSNormInfo::create(y_desc, residual_out_desc, x_desc, residual_desc, w_desc, epsilon);
+    CHECK_RESULT(result);
+
+    *desc_ptr = new Descriptor(result.take(), 0, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+namespace {
+
+/**
+ * 每行只读一次 x 与 residual：相加的结果写入 residual_out 后，平方和直接在刚写入、
+ * 仍在缓存中的 residual_out 上用 reduce_op::sumSquared 计算，再乘以 w 与 1/rms 写入 y。
+ * fp16/bf16 在 fp32 行缓冲区中计算；w 在所有行之前转换一次。
+ */
+template <typename T, typename Tw>
+void addRMSNorm(const AddRMSNormInfo &info, T *y, T *residual_out, const T *x, const T *residual, const Tw *w) {
+    using Tcompute = std::conditional_t<std::is_same_v<T, double>, double, float>;
+    const auto &norm = info.norm;
+    const size_t batch = norm.shape[0], dim = norm.dim();
+
+    std::vector<Tcompute> weight(dim);
+    utils::convert_n(w, dim, weight.data());
+
+#pragma omp parallel
+    {
+        // 半精度时每个线程两行 fp32 缓冲区
+        constexpr bool half = !std::is_same_v<T, Tcompute>;
+        std::vector<float> a(half ? dim : 0), b(half ? dim : 0);
+
+#pragma omp for
+        for (ptrdiff_t i = 0; i < ptrdiff_t(batch); i++) {
+            T *y_ = y + i * norm.y_strides[0];
+            T *out_ = residual_out + i * info.residual_out_strides[0];
+            const T *x_ = x + i * norm.x_strides[0];
+            const T *r_ = residual + i * info.residual_strides[0];
+
+            if constexpr (!half) {
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    out_[j] = x_[j] + r_[j];
+                }
+                const Tcompute ss = op::common_cpu::reduce_op::sumSquared(out_, dim);
+                const Tcompute rms = Tcompute(1) / std::sqrt(ss / Tcompute(dim) + Tcompute(norm.epsilon));
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    y_[j] = out_[j] * weight[j] * rms;
+                }
+            } else {
+                // 先读完 x 与 residual 再写 residual_out，二者可以是同一块内存
+                utils::convert_n(x_, dim, a.data());
+                utils::convert_n(r_, dim, b.data());
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    a[j] += b[j];
+                }
+                utils::convert_n(a.data(), dim, out_);
+
+                // 归一化舍入后的 residual_out，与分开调用 Add 和 RMSNorm 的结果一致
+                const float ss = op::common_cpu::reduce_op::sumSquared(out_, dim);
+                const float rms = 1.f / std::sqrt(ss / float(dim) + norm.epsilon);
+                utils::convert_n(out_, dim, a.data());
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    a[j] *= weight[j] * rms;
+                }
+                utils::convert_n(a.data(), dim, y_);
+            }
+        }
+    }
+}
+
+} // namespace
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace, size_t workspace_size,
+    void *y, void *residual_out,
+    const void *x, const void *residual, const void *w,
+    void *stream) const {
+
+    if (!y || !residual_out || !x || !residual || !w) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+
+    const auto atype = _info.norm.atype, wtype = _info.norm.wtype;
+    if (atype == INFINI_DTYPE_F16) {
+        if (wtype == INFINI_DTYPE_F16) {
+            addRMSNorm(_info, (fp16_t *)y, (fp16_t *)residual_out, (const fp16_t *)x, (const fp16_t *)residual, (const fp16_t *)w);
+        } else if (wtype == INFINI_DTYPE_F32) {
+            addRMSNorm(_info, (fp16_t *)y, (fp16_t *)residual_out, (const fp16_t *)x, (const fp16_t *)residual, (const float *)w);
+        } else {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+    } else if (atype == INFINI_DTYPE_BF16) {
+        if (wtype == INFINI_DTYPE_BF16) {
+            addRMSNorm(_info, (bf16_t *)y, (bf16_t *)residual_out, (const bf16_t *)x, (const bf16_t *)residual, (const bf16_t *)w);
+        } else if (wtype == INFINI_DTYPE_F32) {
+            addRMSNorm(_info, (bf16_t *)y, (bf16_t *)residual_out, (const bf16_t *)x, (const bf16_t *)residual, (const float *)w);
+        } else {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+    } else if (atype == INFINI_DTYPE_F32) {
+        addRMSNorm(_info, (float *)y, (float *)residual_out, (const float *)x, (const float *)residual, (const float *)w);
+    } else if (atype == INFINI_DTYPE_F64) {
+        addRMSNorm(_info, (double *)y, (double *)residual_out, (const double *)x, (const double *)residual, (const double *)w);
+    } else {
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+    return INFINI_STATUS_SUCCESS;
+}
+
+} // namespace op::add_rms_norm::cpu
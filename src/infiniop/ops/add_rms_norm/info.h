@@ -0,0 +1,53 @@
+#ifndef __ADD_RMS_NORM_INFO_H__
+#define __ADD_RMS_NORM_INFO_H__
+
+#include "../rms_norm/info.h"
+
+namespace op::add_rms_norm {
+
+class AddRMSNormInfo {
+    AddRMSNormInfo(
+        rms_norm::RMSNormInfo norm_,
+        std::vector<ptrdiff_t> residual_out_strides_,
+        std::vector<ptrdiff_t> residual_strides_)
+        : norm(std::move(norm_)),
+          residual_out_strides(std::move(residual_out_strides_)),
+          residual_strides(std::move(residual_strides_)) {}
+
+public:
+    // y、x、w 与 RMSNorm 相同
+    rms_norm::RMSNormInfo norm;
+    std::vector<ptrdiff_t> residual_out_strides;
+    std::vector<ptrdiff_t> residual_strides;
+
+    static utils::Result<AddRMSNormInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t residual_out_desc,
+        infiniopTensorDescriptor_t x_desc,
+        infiniopTensorDescriptor_t residual_desc,
+        infiniopTensorDescriptor_t w_desc,
+        float epsilon) {
+
+        auto norm = rms_norm::RMSNormInfo::create(y_desc, x_desc, w_desc, epsilon);
+        CHECK_RESULT(norm);
+
+        for (auto desc : {residual_out_desc, residual_desc}) {
+            if (desc->dtype() != norm->atype) {
+                return INFINI_STATUS_BAD_TENSOR_DTYPE;
+            }
+            CHECK_SAME_SHAPE(desc->shape(), norm->shape);
+            if (desc->stride(1) != 1) {
+                return INFINI_STATUS_BAD_TENSOR_STRIDES;
+            }
+        }
+
+        return utils::Result<AddRMSNormInfo>(AddRMSNormInfo(
+            norm.take(),
+            residual_out_desc->strides(),
+            residual_desc->strides()));
+    }
+};
+
+} // namespace op::add_rms_norm
+
+#endif // __ADD_RMS_NORM_INFO_H__
@@ -0,0 +1,113 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "infiniop/ops/add_rms_norm.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/add_rms_norm_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateAddRMSNormDescriptor(
+    infiniopHandle_t handle,
+    infiniopAddRMSNormDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t residual_out_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t residual_desc,
+    infiniopTensorDescriptor_t w_desc,
+    float epsilon) {
+
+#define CREATE(CASE, NAMESPACE)                                                     \
+    case CASE:                                                                      \
+        return op::add_rms_norm::NAMESPACE::Descriptor::create(                     \
+            handle,                                                                 \
+            reinterpret_cast<op::add_rms_norm::NAMESPACE::Descriptor **>(desc_ptr), \
+            y_desc,                                                                 \
+            residual_out_desc,                                                      \
+            x_desc,                                                                 \
+            residual_desc,                                                          \
+            w_desc,                                                                 \
+            epsilon)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetAddRMSNormWorkspaceSize(
+    infiniopAddRMSNormDescriptor_t desc,
+    size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                              \
+    case CASE:                                                                                            \
+        *size = reinterpret_cast<const op::add_rms_norm::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopAddRMSNorm(
+    infiniopAddRMSNormDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *y,
+    void *residual_out,
+    const void *x,
+    const void *residual,
+    const void *w,
+    void *stream) {
+
+#define CALCULATE(CASE, NAMESPACE)                                                     \
+    case CASE:                                                                         \
+        return reinterpret_cast<const op::add_rms_norm::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, residual_out, x, residual, w, stream)
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t
+infiniopDestroyAddRMSNormDescriptor(infiniopAddRMSNormDescriptor_t desc) {
+
+#define DELETE(CASE, NAMESPACE)                                                         \
+    case CASE:                                                                          \
+        delete reinterpret_cast<const op::add_rms_norm::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
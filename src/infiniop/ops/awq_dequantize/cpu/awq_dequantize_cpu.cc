@@ -0,0 +1,152 @@
+#include "awq_dequantize_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+
+namespace op::awq_dequantize::cpu {
+
+namespace {
+
+// 解包一行：y[j] = (w[j] - z[j]) * s[j]，差值为小整数，乘积只舍入一次
+template <typename Tdata, typename Tscale>
+void dequantizeRowGeneric(Tdata *y, const int32_t *qweight, const int32_t *qzeros, const Tscale *scales, size_t m_packed) {
+    for (size_t p = 0; p < m_packed; ++p) {
+        for (int j = 0; j < AWQ_PACK; ++j) {
+            const int diff = awqUnpack(qweight[p], j) - awqUnpack(qzeros[p], j);
+            y[p * AWQ_PACK + j] = utils::cast<Tdata>(float(diff) * utils::cast<float>(scales[p * AWQ_PACK + j]));
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// 每个 int32 广播到 8 个通道后按列移位，一次得到一组 8 列
+template <typename Tdata, typename Tscale>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dequantizeRowAvx2(Tdata *y, const int32_t *qweight, const int32_t *qzeros, const Tscale *scales, size_t m_packed) {
+    const __m256i shifts = _mm256_setr_epi32(0, 16, 4, 20, 8, 24, 12, 28);
+    const __m256i mask = _mm256_set1_epi32(0xF);
+    for (size_t p = 0; p < m_packed; ++p) {
+        const __m256i w = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(qweight[p]), shifts), mask);
+        const __m256i z = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(qzeros[p]), shifts), mask);
+        __m256 s;
+        if constexpr (std::is_same<Tscale, fp16_t>::value) {
+            s = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(scales + p * AWQ_PACK)));
+        } else {
+            s = _mm256_loadu_ps(scales + p * AWQ_PACK);
+        }
+        const __m256 v = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(w, z)), s);
+        if constexpr (std::is_same<Tdata, fp16_t>::value) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(y + p * AWQ_PACK), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+        } else {
+            _mm256_storeu_ps(y + p * AWQ_PACK, v);
+        }
+    }
+}
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+template <typename Tdata, typename Tscale>
+void dequantize(const AWQDequantizeInfo &info, Tdata *y, const int32_t *qweight, const int32_t *qzeros, const Tscale *scales) {
+    auto row_fn = dequantizeRowGeneric<Tdata, Tscale>;
+#ifdef INFINIOP_CPU_X86_SIMD
+    const auto &isa = device::cpu::isa();
+    if (isa.avx2 && isa.f16c) {
+        row_fn = dequantizeRowAvx2<Tdata, Tscale>;
+    }
+#endif
+    const ptrdiff_t n = ptrdiff_t(info.n);
+    const size_t m = size_t(info.m), m_packed = size_t(info.m_packed);
+
+#pragma omp parallel for
+    for (ptrdiff_t i = 0; i < n; ++i) {
+        const size_t g = size_t(i) / size_t(info.group_size);
+        row_fn(y + i * m,
+               qweight + i * m_packed,
+               qzeros + g * m_packed,
+               scales + g * m,
+               m_packed);
+    }
+}
+
+/**
+ * CPU 内核对布局的要求，AWQDequantizeInfo 本身不检查（其他后端的要求可能不同）：
+ * 每个 int32 打包 8 个 4 位数，每 group_size 行共用一行零点与缩放因子，各张量都是连续的。
+ */
+infiniStatus_t checkLayout(
+    const AWQDequantizeInfo &info,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t qweight_desc,
+    infiniopTensorDescriptor_t zeros_desc,
+    infiniopTensorDescriptor_t scales_desc) {
+    if (info.group_size <= 0 || info.m % AWQ_PACK != 0 || info.zeros_m != info.m) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    if (qweight_desc->dim(0) != size_t(info.n) || qweight_desc->dim(1) != size_t(info.m_packed)
+        || zeros_desc->dim(1) != size_t(info.zeros_m_packed)
+        || scales_desc->dim(0) != size_t(info.zeros_n)
+        || size_t(info.zeros_n) * size_t(info.group_size) < size_t(info.n)) {
+        return INFINI_STATUS_BAD_TENSOR_SHAPE;
+    }
+    if (!y_desc->isContiguous() || !qweight_desc->isContiguous()
+        || !zeros_desc->isContiguous() || !scales_desc->isContiguous()) {
+        return INFINI_STATUS_BAD_TENSOR_STRIDES;
+    }
+    return INFINI_STATUS_SUCCESS;
+}
+
+} // namespace
+
+struct Descriptor::Opaque {};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t qweight_desc,
+    infiniopTensorDescriptor_t zeros_desc,
+    infiniopTensorDescriptor_t scales_desc,
+    int group_size) {
+    auto result = AWQDequantizeInfo::create(y_desc, qweight_desc, zeros_desc, scales_desc, group_size);
+    CHECK_RESULT(result);
+    auto info = result.take();
+    CHECK_STATUS(checkLayout(info, y_desc, qweight_desc, zeros_desc, scales_desc));
+    // 零点在内循环中直接解包，不需要工作空间
+    *desc_ptr = new Descriptor(nullptr, info, 0, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace, size_t workspace_size,
+    void *y, const void *qweight, const void *zeros, const void *scales,
+    void *stream) const {
+
+    auto qweight_ = reinterpret_cast<const int32_t *>(qweight);
+    auto qzeros_ = reinterpret_cast<const int32_t *>(zeros);
+
+#define DEQUANTIZE(TDATA, TSCALE)                                                   \
+    dequantize(_info, reinterpret_cast<TDATA *>(y), qweight_, qzeros_,              \
+               reinterpret_cast<const TSCALE *>(scales));                           \
+    return INFINI_STATUS_SUCCESS
+
+    if (_info.data_type == INFINI_DTYPE_F16) {
+        if (_info.scale_type == INFINI_DTYPE_F16) {
+            DEQUANTIZE(fp16_t, fp16_t);
+        } else {
+            DEQUANTIZE(fp16_t, float);
+        }
+    } else {
+        if (_info.scale_type == INFINI_DTYPE_F16) {
+            DEQUANTIZE(float, fp16_t);
+        } else {
+            DEQUANTIZE(float, float);
+        }
+    }
+
+#undef DEQUANTIZE
+}
+
+} // namespace op::awq_dequantize::cpu
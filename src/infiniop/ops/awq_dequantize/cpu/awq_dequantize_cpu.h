@@ -0,0 +1,8 @@
+#ifndef __AWQ_DEQUANTIZE_CPU_H__
+#define __AWQ_DEQUANTIZE_CPU_H__
+
+#include "../awq_dequantize.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __AWQ_DEQUANTIZE_CPU_H__
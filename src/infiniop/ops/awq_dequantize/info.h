@@ -7,6 +7,17 @@
 
 namespace op::awq_dequantize {
 
+// 每个 int32 打包 8 个 4 位数
+constexpr int AWQ_PACK = 8;
+// 第 i 个半字节（从低位起）对应组内第 AWQ_ORDER[i] 列
+constexpr int AWQ_ORDER[AWQ_PACK] = {0, 2, 4, 6, 1, 3, 5, 7};
+// 组内第 j 列位于第 AWQ_REVERSE_ORDER[j] 个半字节
+constexpr int AWQ_REVERSE_ORDER[AWQ_PACK] = {0, 4, 1, 5, 2, 6, 3, 7};
+
+inline int awqUnpack(int32_t packed, int col) {
+    return int((uint32_t(packed) >> (AWQ_REVERSE_ORDER[col] * 4)) & 0xF);
+}
+
 class AWQDequantizeInfo {
     AWQDequantizeInfo() = default;
 
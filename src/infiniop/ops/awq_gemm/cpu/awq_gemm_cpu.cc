@@ -0,0 +1,351 @@
+#include "awq_gemm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include <algorithm>
+
+namespace op::awq_gemm::cpu {
+
+using awq_dequantize::AWQ_ORDER;
+using awq_dequantize::AWQ_PACK;
+
+namespace {
+
+/**
+ * 权重不解包成按列排列的矩阵，而是按“半字节平面”计算：
+ * 连续 TILE_WORDS 个 int32 的第 s 个半字节组成平面 s，其第 l 个通道对应
+ * 第 l * 8 + AWQ_ORDER[s] 列。一次移位、与、转换即得到一个平面，零点按同样方式解包，
+ * 只有缩放因子和最终写回需要换成平面顺序。
+ *
+ * 同一组内零点与缩放因子不变：
+ *   sum_p(a[p] * (w[p] - z) * s) = s * (sum_p(a[p] * w[p]) - z * sum_p(a[p]))，
+ * 内核只累加 a * w，每组结束时由调用者减去零点并乘以缩放因子。
+ */
+constexpr size_t TILE_WORDS = 16;
+constexpr size_t TILE = AWQ_PACK * TILE_WORDS;
+constexpr size_t MAX_ROWS = 3;
+
+// 每个任务负责 TASK_ROWS 行、TILE 列，输出块按平面顺序留在栈上
+constexpr size_t TASK_ROWS = 32;
+
+/**
+ * 计算 R 行 A 与一组权重的乘积：
+ * acc[(r * AWQ_PACK + s) * TILE_WORDS + l] = sum_p(a[r * lda + p] * nibble(qweight[p * ldq + l], s))。
+ *
+ * words 不足 TILE_WORDS 时多余通道为 0。
+ */
+using DotFn = void (*)(size_t kc, const float *a, size_t lda, const int32_t *qweight, size_t ldq, size_t words, float *acc);
+
+struct Kernels {
+    // fn[r - 1] 计算 r 行
+    DotFn fn[MAX_ROWS];
+};
+
+template <size_t R>
+void dotGeneric(size_t kc, const float *a, size_t lda, const int32_t *qweight, size_t ldq, size_t words, float *acc) {
+    std::fill(acc, acc + R * TILE, 0.f);
+    for (size_t p = 0; p < kc; ++p) {
+        uint32_t w[TILE_WORDS] = {};
+        for (size_t l = 0; l < words; ++l) {
+            w[l] = uint32_t(qweight[p * ldq + l]);
+        }
+        for (size_t s = 0; s < AWQ_PACK; ++s) {
+            for (size_t r = 0; r < R; ++r) {
+                const float av = a[r * lda + p];
+                float *acc_ = acc + (r * AWQ_PACK + s) * TILE_WORDS;
+                for (size_t l = 0; l < TILE_WORDS; ++l) {
+                    acc_[l] += av * float((w[l] >> (s * 4)) & 0xF);
+                }
+            }
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// 以下内核中行、平面的循环须完全展开，累加器才能留在寄存器中
+
+// ymm 只有 16 个寄存器：每趟处理 8 个字中的 4 个平面，共 4 趟，A 与权重在 L1 中重复读取
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma")
+void dotAvx2(size_t kc, const float *a, size_t lda, const int32_t *qweight, size_t ldq, size_t words, float *acc) {
+    const __m256i nibble = _mm256_set1_epi32(0xF);
+    for (size_t l0 = 0; l0 < TILE_WORDS; l0 += 8) {
+        const size_t valid = words > l0 ? std::min(words - l0, size_t(8)) : 0;
+        const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(valid)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        for (size_t s0 = 0; s0 < AWQ_PACK; s0 += 4) {
+            __m256 sum[R][4];
+#pragma GCC unroll 4
+            for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+                for (size_t s = 0; s < 4; ++s) {
+                    sum[r][s] = _mm256_setzero_ps();
+                }
+            }
+            if (valid > 0) {
+                for (size_t p = 0; p < kc; ++p) {
+                    _mm_prefetch(reinterpret_cast<const char *>(qweight + (p + 16) * ldq + l0), _MM_HINT_T0);
+                    const __m256i w = _mm256_srli_epi32(
+                        _mm256_maskload_epi32(reinterpret_cast<const int *>(qweight + p * ldq + l0), mask),
+                        int(s0 * 4));
+                    __m256 av[R];
+#pragma GCC unroll 4
+                    for (size_t r = 0; r < R; ++r) {
+                        av[r] = _mm256_broadcast_ss(a + r * lda + p);
+                    }
+#pragma GCC unroll 4
+                    for (size_t s = 0; s < 4; ++s) {
+                        const __m256 wf = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(w, int(s * 4)), nibble));
+#pragma GCC unroll 4
+                        for (size_t r = 0; r < R; ++r) {
+                            sum[r][s] = _mm256_fmadd_ps(av[r], wf, sum[r][s]);
+                        }
+                    }
+                }
+            }
+#pragma GCC unroll 4
+            for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+                for (size_t s = 0; s < 4; ++s) {
+                    _mm256_storeu_ps(acc + (r * AWQ_PACK + s0 + s) * TILE_WORDS + l0, sum[r][s]);
+                }
+            }
+        }
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+// 一个 zmm 正好装下 TILE_WORDS 个字，8 个平面 x R 行的累加器全部留在寄存器中
+template <size_t R>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl")
+void dotAvx512(size_t kc, const float *a, size_t lda, const int32_t *qweight, size_t ldq, size_t words, float *acc) {
+    const __mmask16 mask = __mmask16((1u << words) - 1);
+    const __m512i nibble = _mm512_set1_epi32(0xF);
+    __m512 sum[R][AWQ_PACK];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 8
+        for (size_t s = 0; s < AWQ_PACK; ++s) {
+            sum[r][s] = _mm512_setzero_ps();
+        }
+    }
+    for (size_t p = 0; p < kc; ++p) {
+        // 每行只读取 64 字节、跨 ldq 个字，硬件预取跟不上，提前预取后续的行
+        _mm_prefetch(reinterpret_cast<const char *>(qweight + (p + 16) * ldq), _MM_HINT_T0);
+        const __m512i w = _mm512_maskz_loadu_epi32(mask, qweight + p * ldq);
+        __m512 av[R];
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            av[r] = _mm512_set1_ps(a[r * lda + p]);
+        }
+#pragma GCC unroll 8
+        for (size_t s = 0; s < AWQ_PACK; ++s) {
+            const __m512 wf = _mm512_cvtepi32_ps(_mm512_and_si512(_mm512_srli_epi32(w, unsigned(s * 4)), nibble));
+#pragma GCC unroll 4
+            for (size_t r = 0; r < R; ++r) {
+                sum[r][s] = _mm512_fmadd_ps(av[r], wf, sum[r][s]);
+            }
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 8
+        for (size_t s = 0; s < AWQ_PACK; ++s) {
+            _mm512_storeu_ps(acc + (r * AWQ_PACK + s) * TILE_WORDS, sum[r][s]);
+        }
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+const Kernels &kernels() {
+    static const Kernels table = [] {
+#ifdef INFINIOP_CPU_X86_SIMD
+        const auto &isa = device::cpu::isa();
+        if (isa.avx512) {
+            return Kernels{{dotAvx512<1>, dotAvx512<2>, dotAvx512<3>}};
+        }
+        if (isa.avx2) {
+            return Kernels{{dotAvx2<1>, dotAvx2<2>, dotAvx2<3>}};
+        }
+#endif
+        return Kernels{{dotGeneric<1>, dotGeneric<2>, dotGeneric<3>}};
+    }();
+    return table;
+}
+
+size_t floatWorkspaceSize(const AWQGemmInfo &info) {
+    // A 转换为 float 按行连续存放，另存每行每组的和
+    return (info.m * info.k + info.m * (info.k / info.group_size)) * sizeof(float);
+}
+
+template <typename Tdata, typename Tscale>
+void awqGemm(
+    const AWQGemmInfo &info,
+    void *workspace,
+    Tdata *c,
+    const Tdata *a,
+    const int32_t *qweight,
+    const int32_t *qzeros,
+    const Tscale *scales) {
+
+    const size_t m = info.m, n = info.n, k = info.k, group_size = info.group_size;
+    const size_t groups = k / group_size, nw = n / AWQ_PACK;
+    if (m == 0 || n == 0) {
+        return;
+    }
+
+    auto a_f = reinterpret_cast<float *>(workspace);
+    auto a_sum = a_f + m * k;
+
+#pragma omp parallel for
+    for (ptrdiff_t i = 0; i < ptrdiff_t(m); ++i) {
+        float *row = a_f + i * k;
+        for (size_t p = 0; p < k; ++p) {
+            row[p] = utils::cast<float>(a[i * info.a_row_stride + ptrdiff_t(p) * info.a_col_stride]);
+        }
+        for (size_t g = 0; g < groups; ++g) {
+            float sum = 0.f;
+            for (size_t p = g * group_size; p < (g + 1) * group_size; ++p) {
+                sum += row[p];
+            }
+            a_sum[i * groups + g] = sum;
+        }
+    }
+
+    const auto &table = kernels();
+    const size_t tiles_m = CEIL_DIV(m, TASK_ROWS);
+    const size_t tiles_n = CEIL_DIV(nw, TILE_WORDS);
+    const ptrdiff_t tasks = ptrdiff_t(tiles_m * tiles_n);
+
+#pragma omp parallel for schedule(static)
+    for (ptrdiff_t t = 0; t < tasks; ++t) {
+        const size_t w0 = size_t(t) % tiles_n * TILE_WORDS;
+        const size_t i0 = size_t(t) / tiles_n * TASK_ROWS;
+        const size_t words = std::min(TILE_WORDS, nw - w0);
+        const size_t mb = std::min(TASK_ROWS, m - i0);
+
+        float out[TASK_ROWS * TILE] = {};
+        float acc[MAX_ROWS * TILE];
+        // 当前组的缩放因子与零点，按平面顺序排列
+        float scale[TILE] = {}, zero[TILE] = {};
+
+        for (size_t g = 0; g < groups; ++g) {
+            for (size_t l = 0; l < words; ++l) {
+                const uint32_t z = uint32_t(qzeros[g * nw + w0 + l]);
+                const Tscale *s_ = scales + g * n + (w0 + l) * AWQ_PACK;
+                for (size_t s = 0; s < size_t(AWQ_PACK); ++s) {
+                    scale[s * TILE_WORDS + l] = utils::cast<float>(s_[AWQ_ORDER[s]]);
+                    zero[s * TILE_WORDS + l] = float((z >> (s * 4)) & 0xF);
+                }
+            }
+
+            const int32_t *qw = qweight + g * group_size * nw + w0;
+            for (size_t i = 0; i < mb; i += MAX_ROWS) {
+                const size_t rows = std::min(MAX_ROWS, mb - i);
+                table.fn[rows - 1](group_size, a_f + (i0 + i) * k + g * group_size, k, qw, nw, words, acc);
+                for (size_t r = 0; r < rows; ++r) {
+                    const float as = a_sum[(i0 + i + r) * groups + g];
+                    float *out_ = out + (i + r) * TILE;
+                    const float *acc_ = acc + r * TILE;
+                    for (size_t q = 0; q < TILE; ++q) {
+                        out_[q] += (acc_[q] - zero[q] * as) * scale[q];
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < mb; ++i) {
+            Tdata *c_ = c + (i0 + i) * info.c_row_stride;
+            for (size_t l = 0; l < words; ++l) {
+                for (size_t s = 0; s < size_t(AWQ_PACK); ++s) {
+                    const size_t j = (w0 + l) * AWQ_PACK + AWQ_ORDER[s];
+                    c_[ptrdiff_t(j) * info.c_col_stride] = utils::cast<Tdata>(out[i * TILE + s * TILE_WORDS + l]);
+                }
+            }
+        }
+    }
+}
+
+template <typename Tdata>
+infiniStatus_t dispatchScale(
+    const AWQGemmInfo &info, void *workspace,
+    void *c, const void *a, const void *qweight, const void *zeros, const void *scales) {
+
+    auto c_ = reinterpret_cast<Tdata *>(c);
+    auto a_ = reinterpret_cast<const Tdata *>(a);
+    auto qweight_ = reinterpret_cast<const int32_t *>(qweight);
+    auto zeros_ = reinterpret_cast<const int32_t *>(zeros);
+
+    switch (info.scale_type) {
+    case INFINI_DTYPE_F16:
+        awqGemm(info, workspace, c_, a_, qweight_, zeros_, reinterpret_cast<const fp16_t *>(scales));
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_BF16:
+        awqGemm(info, workspace, c_, a_, qweight_, zeros_, reinterpret_cast<const bf16_t *>(scales));
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_F32:
+        awqGemm(info, workspace, c_, a_, qweight_, zeros_, reinterpret_cast<const float *>(scales));
+        return INFINI_STATUS_SUCCESS;
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace
+
+struct Descriptor::Opaque {};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t qweight_desc,
+    infiniopTensorDescriptor_t zeros_desc,
+    infiniopTensorDescriptor_t scales_desc,
+    int group_size) {
+    auto result = AWQGemmInfo::create(c_desc, a_desc, qweight_desc, zeros_desc, scales_desc, group_size);
+    CHECK_RESULT(result);
+    auto info = result.take();
+    size_t workspace_size = floatWorkspaceSize(info);
+    *desc_ptr = new Descriptor(nullptr, info, workspace_size, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *qweight,
+    const void *zeros,
+    const void *scales,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        return dispatchScale<fp16_t>(_info, workspace, c, a, qweight, zeros, scales);
+    case INFINI_DTYPE_BF16:
+        return dispatchScale<bf16_t>(_info, workspace, c, a, qweight, zeros, scales);
+    case INFINI_DTYPE_F32:
+        return dispatchScale<float>(_info, workspace, c, a, qweight, zeros, scales);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::awq_gemm::cpu
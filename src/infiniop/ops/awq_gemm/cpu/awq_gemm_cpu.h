@@ -0,0 +1,8 @@
+#ifndef __AWQ_GEMM_CPU_H__
+#define __AWQ_GEMM_CPU_H__
+
+#include "../awq_gemm.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __AWQ_GEMM_CPU_H__
@@ -0,0 +1,74 @@
+#ifndef __AWQ_GEMM_INFO_H__
+#define __AWQ_GEMM_INFO_H__
+
+#include "../awq_dequantize/info.h"
+
+namespace op::awq_gemm {
+
+class AWQGemmInfo {
+    AWQGemmInfo() = default;
+
+public:
+    infiniDtype_t dtype;      // a 与 c 的数据类型
+    infiniDtype_t scale_type; // 缩放因子数据类型
+    size_t m, n, k;
+    size_t group_size;
+    ptrdiff_t a_row_stride, a_col_stride;
+    ptrdiff_t c_row_stride, c_col_stride;
+
+    static utils::Result<AWQGemmInfo> create(
+        infiniopTensorDescriptor_t c_desc,
+        infiniopTensorDescriptor_t a_desc,
+        infiniopTensorDescriptor_t qweight_desc,
+        infiniopTensorDescriptor_t zeros_desc,
+        infiniopTensorDescriptor_t scales_desc,
+        int group_size) {
+
+        auto dtype = c_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        auto scale_type = scales_desc->dtype();
+        CHECK_DTYPE(scale_type, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        if (a_desc->dtype() != dtype
+            || qweight_desc->dtype() != INFINI_DTYPE_I32
+            || zeros_desc->dtype() != INFINI_DTYPE_I32) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+
+        if (c_desc->ndim() != 2 || a_desc->ndim() != 2 || qweight_desc->ndim() != 2
+            || zeros_desc->ndim() != 2 || scales_desc->ndim() != 2) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+
+        size_t m = c_desc->dim(0), n = c_desc->dim(1), k = a_desc->dim(1);
+        // 每个 int32 沿 n 打包 8 个 4 位数，每 group_size 行共用一行零点与缩放因子
+        if (group_size <= 0 || k % size_t(group_size) != 0 || n % 8 != 0) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        size_t groups = k / size_t(group_size);
+        if (a_desc->dim(0) != m
+            || qweight_desc->dim(0) != k || qweight_desc->dim(1) != n / 8
+            || zeros_desc->dim(0) != groups || zeros_desc->dim(1) != n / 8
+            || scales_desc->dim(0) != groups || scales_desc->dim(1) != n) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        if (!qweight_desc->isContiguous() || !zeros_desc->isContiguous() || !scales_desc->isContiguous()) {
+            return INFINI_STATUS_BAD_TENSOR_STRIDES;
+        }
+
+        return utils::Result<AWQGemmInfo>(AWQGemmInfo{
+            dtype,
+            scale_type,
+            m,
+            n,
+            k,
+            size_t(group_size),
+            a_desc->stride(0),
+            a_desc->stride(1),
+            c_desc->stride(0),
+            c_desc->stride(1)});
+    }
+};
+
+} // namespace op::awq_gemm
+
+#endif // __AWQ_GEMM_INFO_H__
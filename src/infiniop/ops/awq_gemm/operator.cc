@@ -0,0 +1,116 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "infiniop/ops/awq_gemm.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/awq_gemm_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateAWQGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopAWQGemmDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t qweight_desc,
+    infiniopTensorDescriptor_t zeros_desc,
+    infiniopTensorDescriptor_t scales_desc,
+    int group_size) {
+
+#define CREATE(CASE, NAMESPACE)                                                  \
+    case CASE:                                                                   \
+        return op::awq_gemm::NAMESPACE::Descriptor::create(                     \
+            handle,                                                              \
+            reinterpret_cast<op::awq_gemm::NAMESPACE::Descriptor **>(desc_ptr), \
+            c_desc,                                                              \
+            a_desc,                                                              \
+            qweight_desc,                                                        \
+            zeros_desc,                                                          \
+            scales_desc,                                                         \
+            group_size)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetAWQGemmWorkspaceSize(
+    infiniopAWQGemmDescriptor_t desc,
+    size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                           \
+    case CASE:                                                                                         \
+        *size = reinterpret_cast<const op::awq_gemm::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopAWQGemm(
+    infiniopAWQGemmDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *qweight,
+    const void *zeros,
+    const void *scales,
+    void *stream) {
+
+#define CALCULATE(CASE, NAMESPACE)                                                  \
+    case CASE:                                                                      \
+        return reinterpret_cast<const op::awq_gemm::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                  \
+                        c, a,                                                       \
+                        qweight, zeros, scales,                                     \
+                        stream)
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t
+infiniopDestroyAWQGemmDescriptor(infiniopAWQGemmDescriptor_t desc) {
+
+#define DELETE(CASE, NAMESPACE)                                                      \
+    case CASE:                                                                       \
+        delete reinterpret_cast<const op::awq_gemm::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -0,0 +1,141 @@
+#include "cast_cpu.h"
+#include "../../../elementwise/cpu/elementwise_cpu.h"
+
+namespace op::cast::cpu {
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = CastInfo::create(y_desc, x_desc);
+    CHECK_RESULT(result);
+
+    *desc_ptr = new Descriptor(result.take(), 0, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+namespace {
+
+template <typename T>
+constexpr bool isHalf = std::is_same_v<T, fp16_t> || std::is_same_v<T, bf16_t>;
+
+// 经 fp32 中转时每次转换的元素个数，中转缓冲区在栈上
+constexpr size_t BLOCK = 256;
+
+/**
+ * 转换连续的一段。fp16/bf16 与 fp32 之间直接调用 utils::convert_n 的向量路径；
+ * fp16/bf16 与其他类型之间先经 fp32 缓冲区中转，使半精度一侧同样走向量路径，
+ * 结果与 utils::cast 一致（它也经 fp32 转换）；其余类型由编译器向量化。
+ */
+template <typename Tout, typename Tin>
+void castContiguous(Tout *y, const Tin *x, size_t len) {
+    if constexpr (std::is_same_v<Tout, Tin>) {
+        std::memmove(y, x, len * sizeof(Tin));
+    } else if constexpr ((std::is_same_v<Tout, float> && isHalf<Tin>) || (isHalf<Tout> && std::is_same_v<Tin, float>)) {
+        utils::convert_n(x, len, y);
+    } else if constexpr (isHalf<Tout> || isHalf<Tin>) {
+        float buf[BLOCK];
+        for (size_t i = 0; i < len; i += BLOCK) {
+            const size_t n = std::min(BLOCK, len - i);
+            castContiguous(buf, x + i, n);
+            castContiguous(y + i, buf, n);
+        }
+    } else {
+#pragma omp simd
+        for (size_t i = 0; i < len; ++i) {
+            y[i] = utils::cast<Tout>(x[i]);
+        }
+    }
+}
+
+template <typename Tout, typename Tin>
+void compute(const CastInfo &info, Tout *y, const Tin *x) {
+#pragma omp parallel
+    {
+        auto [begin, end] = elementwise::cpu::threadRange(info.layout.getOutputSize());
+        elementwise::cpu::walkRange<1>(info.layout, begin, end, [&](size_t len, const std::array<ptrdiff_t, 2> &offsets, const std::array<ptrdiff_t, 2> &strides) {
+            Tout *y_ = y + offsets[0];
+            const Tin *x_ = x + offsets[1];
+            if (strides[0] == 1 && strides[1] == 1) {
+                return castContiguous(y_, x_, len);
+            }
+            // 输入沿这一段广播时只转换一次
+            if (strides[1] == 0) {
+                const Tout value = utils::cast<Tout>(x_[0]);
+                for (size_t j = 0; j < len; ++j) {
+                    y_[ptrdiff_t(j) * strides[0]] = value;
+                }
+                return;
+            }
+            for (size_t j = 0; j < len; ++j) {
+                y_[ptrdiff_t(j) * strides[0]] = utils::cast<Tout>(x_[ptrdiff_t(j) * strides[1]]);
+            }
+        });
+    }
+}
+
+#define CAST_DTYPES(X)            \
+    X(INFINI_DTYPE_BOOL, bool)    \
+    X(INFINI_DTYPE_I8, int8_t)    \
+    X(INFINI_DTYPE_I16, int16_t)  \
+    X(INFINI_DTYPE_I32, int32_t)  \
+    X(INFINI_DTYPE_I64, int64_t)  \
+    X(INFINI_DTYPE_U8, uint8_t)   \
+    X(INFINI_DTYPE_U16, uint16_t) \
+    X(INFINI_DTYPE_U32, uint32_t) \
+    X(INFINI_DTYPE_U64, uint64_t) \
+    X(INFINI_DTYPE_F16, fp16_t)   \
+    X(INFINI_DTYPE_BF16, bf16_t)  \
+    X(INFINI_DTYPE_F32, float)    \
+    X(INFINI_DTYPE_F64, double)
+
+template <typename Tout>
+infiniStatus_t dispatchInput(const CastInfo &info, void *y, const void *x) {
+#define CASE(DTYPE, TYPE)                                                              \
+    case DTYPE:                                                                        \
+        compute(info, reinterpret_cast<Tout *>(y), reinterpret_cast<const TYPE *>(x)); \
+        return INFINI_STATUS_SUCCESS;
+
+    switch (info.x_dtype) {
+        CAST_DTYPES(CASE)
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+#undef CASE
+}
+
+} // namespace
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    void *stream) const {
+
+    if (!y || !x) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+
+#define CASE(DTYPE, TYPE) \
+    case DTYPE:           \
+        return dispatchInput<TYPE>(_info, y, x);
+
+    switch (_info.y_dtype) {
+        CAST_DTYPES(CASE)
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+#undef CASE
+}
+
+#undef CAST_DTYPES
+
+} // namespace op::cast::cpu
@@ -0,0 +1,8 @@
+#ifndef __CAST_CPU_H__
+#define __CAST_CPU_H__
+
+#include "../cast.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __CAST_CPU_H__
@@ -0,0 +1,46 @@
+#ifndef __CAST_INFO_H__
+#define __CAST_INFO_H__
+
+#include "../../elementwise/elementwise.h"
+
+namespace op::cast {
+
+class CastInfo {
+    CastInfo(
+        infiniDtype_t y_dtype_,
+        infiniDtype_t x_dtype_,
+        elementwise::ElementwiseInfo layout_)
+        : y_dtype(y_dtype_), x_dtype(x_dtype_), layout(std::move(layout_)) {}
+
+public:
+    infiniDtype_t y_dtype, x_dtype;
+    // 输出与输入合并维度后的布局，与单输入的逐元素算子相同
+    elementwise::ElementwiseInfo layout;
+
+    static utils::Result<CastInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t x_desc) {
+
+        if (!y_desc || !x_desc) {
+            return INFINI_STATUS_NULL_POINTER;
+        }
+
+        for (auto dtype : {y_desc->dtype(), x_desc->dtype()}) {
+            CHECK_DTYPE(dtype, INFINI_DTYPE_BOOL,
+                        INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
+                        INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
+                        INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32, INFINI_DTYPE_F64);
+        }
+
+        CHECK_SAME_SHAPE(y_desc->shape(), x_desc->shape());
+
+        auto layout = elementwise::ElementwiseInfo::create(y_desc, {x_desc});
+        CHECK_RESULT(layout);
+
+        return utils::Result<CastInfo>(CastInfo(y_desc->dtype(), x_desc->dtype(), layout.take()));
+    }
+};
+
+} // namespace op::cast
+
+#endif // __CAST_INFO_H__
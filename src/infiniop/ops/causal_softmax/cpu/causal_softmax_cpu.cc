@@ -1,6 +1,11 @@
 #include "causal_softmax_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_math.h"
+#include "../../../elementwise/cpu/elementwise_cpu.h"
 #include "../../../reduce/cpu/reduce.h"
+#include <cmath>
+#include <limits>
+#include <vector>
 
 namespace op::causal_softmax::cpu {
 
@@ -17,41 +22,163 @@ infiniStatus_t Descriptor::create(
     return INFINI_STATUS_SUCCESS;
 }
 
+// 每次在 fp32 缓冲区中处理的元素个数，一段留在 L1 中完成转换、求最大值、exp 与求和
+constexpr size_t CHUNK = 1024;
+// 行数少于线程数且行不短于这个长度时，多个线程分担同一行
+constexpr size_t SPLIT_MIN_LEN = 4 * CHUNK;
+
+/*
+ * 在线 softmax：第一遍按段读 x，维护到当前段为止的最大值 max 与 sum(exp(x - max))，
+ * 最大值增大时把已有的和乘以 exp(旧 max - 新 max)；各段的 exp(x - 段末 max) 保留在 fp32 行缓冲区中。
+ * 第二遍每段只需乘以 exp(段末 max - 全行 max) / sum 并写回 y，不再计算 exp。
+ *
+ * 一行的各段可以分给不同线程：每个线程对自己的段得到 (max, sum)，按同样的方式合并后再做第二遍。
+ */
+
+// 第一遍：处理长为 len 的行中第 [chunk_begin, chunk_end) 段，把结果合并进 max 与 sum
 template <typename T>
-infiniStatus_t causal_softmax(const CausalSoftmaxInfo *info, T *y, const T *x) {
-#pragma omp parallel for
-    for (ptrdiff_t index = 0; index < ptrdiff_t(info->batch_size * info->seq_len); index++) {
-        size_t batch = index / info->seq_len;
-        size_t i = (index % info->seq_len);
-        ptrdiff_t y_offset = batch * info->y_stride_b + i * info->y_stride_i;
-        ptrdiff_t x_offset = batch * info->x_stride_b + i * info->x_stride_i;
-        T *y_ = y + y_offset;
-        const T *x_ = x + x_offset;
-
-        for (size_t j = info->total_seq_len - info->seq_len + i + 1; j < info->total_seq_len; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(0.0f);
-            } else {
-                y_[j * info->y_stride_j] = 0.0f;
+void accumulateChunks(const T *x, ptrdiff_t x_stride, size_t len, float *row, float *chunk_max,
+                      size_t chunk_begin, size_t chunk_end, float &max, float &sum) {
+    using namespace op::common_cpu;
+
+    for (size_t c = chunk_begin; c < chunk_end; ++c) {
+        const size_t begin = c * CHUNK, n = std::min(CHUNK, len - begin);
+        float *chunk = row + begin;
+        if (x_stride == 1) {
+            utils::convert_n(x + begin, n, chunk);
+        } else {
+            for (size_t j = 0; j < n; j++) {
+                chunk[j] = utils::cast<float>(x[ptrdiff_t(begin + j) * x_stride]);
             }
         }
-        float val = op::common_cpu::reduce_op::max(x_, info->total_seq_len - info->seq_len + i + 1, info->x_stride_j);
-        for (size_t j = 0; j <= info->total_seq_len - info->seq_len + i; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(std::exp(utils::cast<float>(x_[j * info->x_stride_j]) - val));
-            } else {
-                y_[j * info->y_stride_j] = std::exp(x_[j * info->x_stride_j] - val);
+        const float new_max = std::max(max, reduce_op::max(chunk, n));
+        if (new_max > max) {
+            sum *= std::exp(max - new_max);
+            max = new_max;
+        }
+        device::cpu::math::exp(chunk, chunk, n, 1.f, -max);
+        sum += reduce_op::sum(chunk, n);
+        chunk_max[c] = max;
+    }
+}
+
+// 第二遍：按全行的 max 与 sum 归一化第 [chunk_begin, chunk_end) 段并写回 y
+template <typename T>
+void normalizeChunks(T *y, ptrdiff_t y_stride, size_t len, float *row, const float *chunk_max,
+                     size_t chunk_begin, size_t chunk_end, float max, float sum) {
+    for (size_t c = chunk_begin; c < chunk_end; ++c) {
+        const size_t begin = c * CHUNK, n = std::min(CHUNK, len - begin);
+        float *chunk = row + begin;
+        const float scale = std::exp(chunk_max[c] - max) / sum;
+        if constexpr (std::is_same_v<T, float>) {
+            if (y_stride == 1) {
+#pragma omp simd
+                for (size_t j = 0; j < n; j++) {
+                    y[begin + j] = chunk[j] * scale;
+                }
+                continue;
             }
         }
-        float sum = op::common_cpu::reduce_op::sum(y_, info->total_seq_len - info->seq_len + i + 1, info->y_stride_j);
-        for (size_t j = 0; j <= info->total_seq_len - info->seq_len + i; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(utils::cast<float>(y_[j * info->y_stride_j]) / sum);
-            } else {
-                y_[j * info->y_stride_j] = y_[j * info->y_stride_j] / sum;
+#pragma omp simd
+        for (size_t j = 0; j < n; j++) {
+            chunk[j] *= scale;
+        }
+        if (y_stride == 1) {
+            utils::convert_n(chunk, n, y + begin);
+        } else {
+            for (size_t j = 0; j < n; j++) {
+                y[ptrdiff_t(begin + j) * y_stride] = utils::cast<T>(chunk[j]);
             }
         }
     }
+}
+
+// 被遮住的 [begin, end) 置 0
+template <typename T>
+void zeroFill(T *y, ptrdiff_t y_stride, size_t begin, size_t end) {
+    for (size_t j = begin; j < end; j++) {
+        y[ptrdiff_t(j) * y_stride] = utils::cast<T>(0.0f);
+    }
+}
+
+template <typename T>
+infiniStatus_t causal_softmax(const CausalSoftmaxInfo *info, T *y, const T *x) {
+    const size_t rows = info->batch_size * info->seq_len;
+    const size_t chunks = CEIL_DIV(info->total_seq_len, CHUNK);
+    const ptrdiff_t x_stride = info->x_stride_j, y_stride = info->y_stride_j;
+#ifdef ENABLE_OMP
+    const size_t max_threads = size_t(omp_get_max_threads());
+#else
+    const size_t max_threads = 1;
+#endif
+
+    auto row_x = [&](size_t index) {
+        return x + (index / info->seq_len) * info->x_stride_b + (index % info->seq_len) * info->x_stride_i;
+    };
+    auto row_y = [&](size_t index) {
+        return y + (index / info->seq_len) * info->y_stride_b + (index % info->seq_len) * info->y_stride_i;
+    };
+    // 第 i 行可见的前 len 个元素
+    auto row_len = [&](size_t index) {
+        return info->total_seq_len - info->seq_len + index % info->seq_len + 1;
+    };
+
+    if (rows < max_threads && info->total_seq_len >= SPLIT_MIN_LEN) {
+        // 逐行处理，每行的段分给所有线程；行缓冲区与各线程的 (max, sum) 共享
+        std::vector<float> row(info->total_seq_len), chunk_max(chunks);
+        std::vector<std::pair<float, float>> partials(max_threads);
+#pragma omp parallel
+        {
+#ifdef ENABLE_OMP
+            const size_t threads = size_t(omp_get_num_threads());
+            const size_t tid = size_t(omp_get_thread_num());
+#else
+            const size_t threads = 1, tid = 0;
+#endif
+            for (size_t index = 0; index < rows; index++) {
+                const size_t len = row_len(index);
+                auto [chunk_begin, chunk_end] = elementwise::cpu::threadRange(CEIL_DIV(len, CHUNK));
+
+                float max = -std::numeric_limits<float>::infinity(), sum = 0;
+                accumulateChunks(row_x(index), x_stride, len, row.data(), chunk_max.data(), chunk_begin, chunk_end, max, sum);
+                partials[tid] = {max, sum};
+#pragma omp barrier
+                // 各线程按相同顺序合并，得到相同的结果；没有分到段的线程 sum 为 0，不参与合并
+                max = -std::numeric_limits<float>::infinity();
+                for (size_t t = 0; t < threads; t++) {
+                    if (partials[t].second != 0) {
+                        max = std::max(max, partials[t].first);
+                    }
+                }
+                sum = 0;
+                for (size_t t = 0; t < threads; t++) {
+                    if (partials[t].second != 0) {
+                        sum += partials[t].second * std::exp(partials[t].first - max);
+                    }
+                }
+                normalizeChunks(row_y(index), y_stride, len, row.data(), chunk_max.data(), chunk_begin, chunk_end, max, sum);
+                auto [zero_begin, zero_end] = elementwise::cpu::threadRange(info->total_seq_len - len);
+                zeroFill(row_y(index), y_stride, len + zero_begin, len + zero_end);
+                // 下一行会改写行缓冲区与 partials
+#pragma omp barrier
+            }
+        }
+        return INFINI_STATUS_SUCCESS;
+    }
+
+#pragma omp parallel
+    {
+        // 每个线程一行 fp32 缓冲区与每段的最大值
+        std::vector<float> row(info->total_seq_len), chunk_max(chunks);
+#pragma omp for
+        for (ptrdiff_t index = 0; index < ptrdiff_t(rows); index++) {
+            const size_t len = row_len(index);
+            float max = -std::numeric_limits<float>::infinity(), sum = 0;
+            accumulateChunks(row_x(index), x_stride, len, row.data(), chunk_max.data(), 0, CEIL_DIV(len, CHUNK), max, sum);
+            normalizeChunks(row_y(index), y_stride, len, row.data(), chunk_max.data(), 0, CEIL_DIV(len, CHUNK), max, sum);
+            zeroFill(row_y(index), y_stride, len, info->total_seq_len);
+        }
+    }
 
     return INFINI_STATUS_SUCCESS;
 }
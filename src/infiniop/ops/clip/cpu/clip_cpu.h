@@ -16,6 +16,17 @@ public:
     T operator()(const T &x, const T &min_val, const T &max_val) const {
         return std::max(std::min(x, max_val), min_val);
     }
+#ifdef INFINIOP_CPU_X86_SIMD
+    // 操作数顺序与 std::min/std::max 的比较方式一致，x 为 NaN 时结果相同
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+    __m256 operator()(__m256 x, __m256 min_val, __m256 max_val) const {
+        return _mm256_max_ps(min_val, _mm256_min_ps(max_val, x));
+    }
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+    __m512 operator()(__m512 x, __m512 min_val, __m512 max_val) const {
+        return _mm512_max_ps(min_val, _mm512_min_ps(max_val, x));
+    }
+#endif
 } ClipOp;
 
 } // namespace op::clip::cpu
@@ -0,0 +1,280 @@
+#include "fused_elementwise_cpu.h"
+#include "../../../elementwise/cpu/elementwise_cpu.h"
+#include "../../add/cpu/add_cpu.h"
+#include "../../clip/cpu/clip_cpu.h"
+#include "../../mul/cpu/mul_cpu.h"
+#include "../../relu/cpu/relu_cpu.h"
+#include "../../sub/cpu/sub_cpu.h"
+#include "../../swiglu/cpu/swiglu_cpu.h"
+
+namespace op::fused_elementwise::cpu {
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    size_t input_count,
+    const infiniopTensorDescriptor_t *x_descs,
+    size_t node_count,
+    const infiniopElementwiseNode_t *nodes) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = FusedElementwiseInfo::create(y_desc, input_count, x_descs, node_count, nodes);
+    CHECK_RESULT(result);
+
+    *desc_ptr = new Descriptor(result.take(), 0, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+namespace {
+
+constexpr size_t MAX_VALUES = INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS + INFINIOP_FUSED_ELEMENTWISE_MAX_NODES;
+
+/**
+ * 依次计算各节点：VALUES[i][u] 中前 input_count 项为输入的值，第 k 个节点的结果写入
+ * VALUES[input_count + k][u]，u < COUNT。元素为 float 时调用各算子的标量形式，为向量
+ * 类型时调用其向量形式；向量形式只能在带有相应 target 属性的函数中调用，因此用宏展开
+ * 到各路径中。每个节点一次处理 COUNT 组值，以分摊按节点类型分派的开销。
+ */
+#define EVALUATE_NODES(NODES, NODE_COUNT, INPUT_COUNT, VALUES, COUNT)                    \
+    for (size_t k = 0; k < (NODE_COUNT); ++k) {                                          \
+        const unsigned int *x = (NODES)[k].operands;                                     \
+        auto *y = (VALUES)[(INPUT_COUNT) + k];                                           \
+        auto *x0 = (VALUES)[x[0]];                                                       \
+        switch ((NODES)[k].op) {                                                         \
+        case INFINIOP_ELEMENTWISE_ADD:                                                   \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = add::cpu::AddOp{}(x0[u], (VALUES)[x[1]][u]);                      \
+            }                                                                            \
+            break;                                                                       \
+        case INFINIOP_ELEMENTWISE_SUB:                                                   \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = sub::cpu::SubOp{}(x0[u], (VALUES)[x[1]][u]);                      \
+            }                                                                            \
+            break;                                                                       \
+        case INFINIOP_ELEMENTWISE_MUL:                                                   \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = mul::cpu::MulOp{}(x0[u], (VALUES)[x[1]][u]);                      \
+            }                                                                            \
+            break;                                                                       \
+        case INFINIOP_ELEMENTWISE_RELU:                                                  \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = relu::cpu::ReluOp{}(x0[u]);                                       \
+            }                                                                            \
+            break;                                                                       \
+        case INFINIOP_ELEMENTWISE_CLIP:                                                  \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = clip::cpu::ClipOp{}(x0[u], (VALUES)[x[1]][u], (VALUES)[x[2]][u]); \
+            }                                                                            \
+            break;                                                                       \
+        case INFINIOP_ELEMENTWISE_SWIGLU:                                                \
+            for (size_t u = 0; u < (COUNT); ++u) {                                       \
+                y[u] = swiglu::cpu::SwiGLUOp{}(x0[u], (VALUES)[x[1]][u]);                \
+            }                                                                            \
+            break;                                                                       \
+        }                                                                                \
+    }
+
+// 每次计算的向量（标量路径为元素）组数
+constexpr size_t UNROLL = 4;
+
+// 一段连续的输出元素及各输入在这一段上的起点与步长；按值传递，使编译器不必在每次存储后重新读取
+template <typename Tdata>
+struct Run {
+    Tdata *y;
+    ptrdiff_t y_stride;
+    const Tdata *x[INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS];
+    ptrdiff_t x_strides[INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS];
+    size_t len;
+};
+
+// 任意步长，逐元素计算
+template <typename Tdata>
+void runScalar(const FusedElementwiseInfo &info, Run<Tdata> run, size_t begin) {
+    const size_t input_count = info.inputCount();
+    const auto *nodes = info.nodes.data();
+    const size_t node_count = info.nodes.size();
+    const size_t output = input_count + node_count - 1;
+    float values[MAX_VALUES][UNROLL];
+    for (size_t j = begin; j < run.len; j += UNROLL) {
+        const size_t count = std::min(UNROLL, run.len - j);
+        for (size_t i = 0; i < input_count; ++i) {
+            for (size_t u = 0; u < count; ++u) {
+                values[i][u] = utils::cast<float>(run.x[i][ptrdiff_t(j + u) * run.x_strides[i]]);
+            }
+        }
+        EVALUATE_NODES(nodes, node_count, input_count, values, count);
+        for (size_t u = 0; u < count; ++u) {
+            run.y[ptrdiff_t(j + u) * run.y_stride] = utils::cast<Tdata>(values[output][u]);
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+using namespace elementwise::cpu::simd;
+
+// 以下向量路径要求输出连续，输入连续或沿这一段广播（步长为 0）
+
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+void runAvx2(const FusedElementwiseInfo &info, Run<Tdata> run) {
+    const size_t input_count = info.inputCount();
+    const auto *nodes = info.nodes.data();
+    const size_t node_count = info.nodes.size();
+    const size_t output = input_count + node_count - 1;
+    __m256 values[MAX_VALUES][UNROLL], bcast[INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS];
+    for (size_t i = 0; i < input_count; ++i) {
+        bcast[i] = _mm256_set1_ps(utils::cast<float>(run.x[i][0]));
+    }
+    // 完整的向量组，最后不足一个向量的部分走标量路径
+    size_t j = 0;
+    while (j + 8 <= run.len) {
+        const size_t count = std::min(UNROLL, (run.len - j) / 8);
+        for (size_t i = 0; i < input_count; ++i) {
+            for (size_t u = 0; u < count; ++u) {
+                values[i][u] = run.x_strides[i] ? loadAvx2(run.x[i] + j + u * 8) : bcast[i];
+            }
+        }
+        EVALUATE_NODES(nodes, node_count, input_count, values, count);
+        for (size_t u = 0; u < count; ++u) {
+            storeAvx2(run.y + j + u * 8, values[output][u]);
+        }
+        j += count * 8;
+    }
+    runScalar(info, run, j);
+}
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+// 尾部用掩码加载与存储
+template <typename Tdata>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+void runAvx512(const FusedElementwiseInfo &info, Run<Tdata> run) {
+    const size_t input_count = info.inputCount();
+    const auto *nodes = info.nodes.data();
+    const size_t node_count = info.nodes.size();
+    const size_t output = input_count + node_count - 1;
+    __m512 values[MAX_VALUES][UNROLL], bcast[INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS];
+    for (size_t i = 0; i < input_count; ++i) {
+        bcast[i] = _mm512_set1_ps(utils::cast<float>(run.x[i][0]));
+    }
+    for (size_t j = 0; j < run.len; j += UNROLL * 16) {
+        const size_t count = std::min(UNROLL, (run.len - j + 15) / 16);
+        __mmask16 masks[UNROLL];
+        for (size_t u = 0; u < count; ++u) {
+            const size_t rest = run.len - j - u * 16;
+            masks[u] = rest >= 16 ? __mmask16(0xffff) : __mmask16((1u << rest) - 1);
+        }
+        for (size_t i = 0; i < input_count; ++i) {
+            for (size_t u = 0; u < count; ++u) {
+                values[i][u] = run.x_strides[i] ? loadAvx512(run.x[i] + j + u * 16, masks[u]) : bcast[i];
+            }
+        }
+        EVALUATE_NODES(nodes, node_count, input_count, values, count);
+        for (size_t u = 0; u < count; ++u) {
+            storeAvx512(run.y + j + u * 16, values[output][u], masks[u]);
+        }
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+#undef EVALUATE_NODES
+
+enum class Path {
+    SCALAR,
+    AVX2,
+    AVX512,
+};
+
+Path selectPath() {
+#ifdef INFINIOP_CPU_X86_SIMD
+    const auto &isa = device::cpu::isa();
+    if (isa.avx512 && isa.f16c) {
+        return Path::AVX512;
+    }
+    if (isa.avx2 && isa.f16c) {
+        return Path::AVX2;
+    }
+#endif
+    return Path::SCALAR;
+}
+
+template <typename Tdata, size_t N>
+void compute(const FusedElementwiseInfo &info, Tdata *y, const void *const *x) {
+    const Path path = selectPath();
+#pragma omp parallel
+    {
+        auto [begin, end] = elementwise::cpu::threadRange(info.layout.getOutputSize());
+        elementwise::cpu::walkRange<N>(info.layout, begin, end, [&](size_t len, const std::array<ptrdiff_t, N + 1> &offsets, const std::array<ptrdiff_t, N + 1> &strides) {
+            Run<Tdata> run;
+            run.y = y + offsets[0];
+            run.y_stride = strides[0];
+            run.len = len;
+            bool vector = strides[0] == 1;
+            for (size_t i = 0; i < N; ++i) {
+                run.x[i] = reinterpret_cast<const Tdata *>(x[i]) + offsets[i + 1];
+                run.x_strides[i] = strides[i + 1];
+                vector = vector && (strides[i + 1] == 0 || strides[i + 1] == 1);
+            }
+#ifdef INFINIOP_CPU_X86_SIMD
+            if (vector && path == Path::AVX512) {
+                return runAvx512(info, run);
+            }
+            if (vector && path == Path::AVX2) {
+                return runAvx2(info, run);
+            }
+#endif
+            runScalar(info, run, 0);
+        });
+    }
+}
+
+// walkRange 需要编译期的输入个数，这里按运行时的个数分派
+template <typename Tdata, size_t N = 1>
+void dispatch(const FusedElementwiseInfo &info, Tdata *y, const void *const *x) {
+    if constexpr (N < INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS) {
+        if (info.inputCount() != N) {
+            return dispatch<Tdata, N + 1>(info, y, x);
+        }
+    }
+    compute<Tdata, N>(info, y, x);
+}
+
+} // namespace
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *const *x,
+    void *stream) const {
+
+    if (!y || !x) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        dispatch(_info, reinterpret_cast<fp16_t *>(y), x);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_BF16:
+        dispatch(_info, reinterpret_cast<bf16_t *>(y), x);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_F32:
+        dispatch(_info, reinterpret_cast<float *>(y), x);
+        return INFINI_STATUS_SUCCESS;
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::fused_elementwise::cpu
@@ -0,0 +1,8 @@
+#ifndef __FUSED_ELEMENTWISE_CPU_H__
+#define __FUSED_ELEMENTWISE_CPU_H__
+
+#include "../fused_elementwise.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __FUSED_ELEMENTWISE_CPU_H__
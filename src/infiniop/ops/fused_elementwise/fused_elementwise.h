@@ -0,0 +1,45 @@
+#ifndef __FUSED_ELEMENTWISE_H__
+#define __FUSED_ELEMENTWISE_H__
+
+#include "../../operator.h"
+#include "info.h"
+
+#define DESCRIPTOR(NAMESPACE)                                    \
+                                                                 \
+    namespace op::fused_elementwise::NAMESPACE {                 \
+    class Descriptor final : public InfiniopDescriptor {         \
+        FusedElementwiseInfo _info;                              \
+        size_t _workspace_size;                                  \
+                                                                 \
+        Descriptor(                                              \
+            FusedElementwiseInfo info,                           \
+            size_t workspace_size,                               \
+            infiniDevice_t device_type,                          \
+            int device_id)                                       \
+            : InfiniopDescriptor{device_type, device_id},        \
+              _info(std::move(info)),                            \
+              _workspace_size(workspace_size) {}                 \
+                                                                 \
+    public:                                                      \
+        ~Descriptor();                                           \
+                                                                 \
+        size_t workspaceSize() const { return _workspace_size; } \
+                                                                 \
+        static infiniStatus_t create(                            \
+            infiniopHandle_t handle,                             \
+            Descriptor **desc_ptr,                               \
+            infiniopTensorDescriptor_t y_desc,                   \
+            size_t input_count,                                  \
+            const infiniopTensorDescriptor_t *x_descs,           \
+            size_t node_count,                                   \
+            const infiniopElementwiseNode_t *nodes);             \
+                                                                 \
+        infiniStatus_t calculate(                                \
+            void *workspace, size_t workspace_size,              \
+            void *y,                                             \
+            const void *const *x,                                \
+            void *stream) const;                                 \
+    };                                                           \
+    }
+
+#endif // __FUSED_ELEMENTWISE_H__
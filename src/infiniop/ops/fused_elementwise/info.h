@@ -0,0 +1,98 @@
+#ifndef __FUSED_ELEMENTWISE_INFO_H__
+#define __FUSED_ELEMENTWISE_INFO_H__
+
+#include "../../elementwise/elementwise.h"
+#include "infiniop/ops/fused_elementwise.h"
+#include <vector>
+
+namespace op::fused_elementwise {
+
+// 各算子的操作数个数，非法的算子返回 0
+inline size_t operandCount(infiniopElementwiseOp_t op) {
+    switch (op) {
+    case INFINIOP_ELEMENTWISE_RELU:
+        return 1;
+    case INFINIOP_ELEMENTWISE_ADD:
+    case INFINIOP_ELEMENTWISE_SUB:
+    case INFINIOP_ELEMENTWISE_MUL:
+    case INFINIOP_ELEMENTWISE_SWIGLU:
+        return 2;
+    case INFINIOP_ELEMENTWISE_CLIP:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+class FusedElementwiseInfo {
+    FusedElementwiseInfo(
+        infiniDtype_t dtype_,
+        elementwise::ElementwiseInfo layout_,
+        std::vector<infiniopElementwiseNode_t> nodes_)
+        : dtype(dtype_), layout(std::move(layout_)), nodes(std::move(nodes_)) {}
+
+public:
+    infiniDtype_t dtype;
+    // 输出与各输入合并维度后的布局，与单个逐元素算子相同
+    elementwise::ElementwiseInfo layout;
+    // 按拓扑顺序排列的节点，最后一个节点的结果写入输出
+    std::vector<infiniopElementwiseNode_t> nodes;
+
+    size_t inputCount() const {
+        return layout.getInputSize();
+    }
+
+    static utils::Result<FusedElementwiseInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        size_t input_count,
+        const infiniopTensorDescriptor_t *x_descs,
+        size_t node_count,
+        const infiniopElementwiseNode_t *nodes) {
+
+        if (!y_desc || (input_count && !x_descs) || !nodes) {
+            return INFINI_STATUS_NULL_POINTER;
+        }
+        if (input_count == 0 || input_count > INFINIOP_FUSED_ELEMENTWISE_MAX_INPUTS
+            || node_count == 0 || node_count > INFINIOP_FUSED_ELEMENTWISE_MAX_NODES) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+
+        auto dtype = y_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        std::vector<infiniopTensorDescriptor_t> input_descs(x_descs, x_descs + input_count);
+        for (auto desc : input_descs) {
+            if (!desc) {
+                return INFINI_STATUS_NULL_POINTER;
+            }
+            if (desc->dtype() != dtype) {
+                return INFINI_STATUS_BAD_TENSOR_DTYPE;
+            }
+            CHECK_SAME_SHAPE(y_desc->shape(), desc->shape());
+        }
+
+        // 每个操作数只能引用输入或之前的节点，保证节点构成按拓扑排序的 DAG
+        for (size_t k = 0; k < node_count; ++k) {
+            const size_t arity = operandCount(nodes[k].op);
+            if (arity == 0) {
+                return INFINI_STATUS_BAD_PARAM;
+            }
+            for (size_t i = 0; i < arity; ++i) {
+                if (nodes[k].operands[i] >= input_count + k) {
+                    return INFINI_STATUS_BAD_PARAM;
+                }
+            }
+        }
+
+        auto layout = elementwise::ElementwiseInfo::create(y_desc, input_descs);
+        CHECK_RESULT(layout);
+
+        return utils::Result<FusedElementwiseInfo>(FusedElementwiseInfo(
+            dtype,
+            layout.take(),
+            std::vector<infiniopElementwiseNode_t>(nodes, nodes + node_count)));
+    }
+};
+
+} // namespace op::fused_elementwise
+
+#endif // __FUSED_ELEMENTWISE_INFO_H__
@@ -0,0 +1,108 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "infiniop/ops/fused_elementwise.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/fused_elementwise_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateFusedElementwiseDescriptor(
+    infiniopHandle_t handle,
+    infiniopFusedElementwiseDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    size_t input_count,
+    const infiniopTensorDescriptor_t *x_descs,
+    size_t node_count,
+    const infiniopElementwiseNode_t *nodes) {
+
+#define CREATE(CASE, NAMESPACE)                                                          \
+    case CASE:                                                                           \
+        return op::fused_elementwise::NAMESPACE::Descriptor::create(                     \
+            handle,                                                                      \
+            reinterpret_cast<op::fused_elementwise::NAMESPACE::Descriptor **>(desc_ptr), \
+            y_desc,                                                                      \
+            input_count,                                                                 \
+            x_descs,                                                                     \
+            node_count,                                                                  \
+            nodes)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetFusedElementwiseWorkspaceSize(
+    infiniopFusedElementwiseDescriptor_t desc,
+    size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                                   \
+    case CASE:                                                                                                 \
+        *size = reinterpret_cast<const op::fused_elementwise::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopFusedElementwise(
+    infiniopFusedElementwiseDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *y,
+    const void *const *x,
+    void *stream) {
+
+#define CALCULATE(CASE, NAMESPACE)                                                          \
+    case CASE:                                                                              \
+        return reinterpret_cast<const op::fused_elementwise::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, x, stream)
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t
+infiniopDestroyFusedElementwiseDescriptor(infiniopFusedElementwiseDescriptor_t desc) {
+
+#define DELETE(CASE, NAMESPACE)                                                              \
+    case CASE:                                                                               \
+        delete reinterpret_cast<const op::fused_elementwise::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -1,16 +1,53 @@
 #include "gemm_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
+#include "gemm_engine_cpu.h"
+#include "gemm_tune_cpu.h"
+#include "gemv_cpu.h"
 
 namespace op::gemm::cpu {
 
-Descriptor::~Descriptor() = default;
+struct Descriptor::Opaque {
+    BlockConfig config;
+    // m 或 n 很小时（如解码阶段的单行激活）使用 GEMV 路径
+    bool gemv;
+    // 后处理的布局，bias 与 residual 的指针在计算时填入
+    Epilogue epilogue;
+    bool bias, residual;
+
+    // 填入 bias 与 residual 后的后处理，缺少描述符要求的输入时返回 false
+    bool bind(Epilogue &ep, const void *bias_, const void *residual_) const {
+        if ((bias && !bias_) || (residual && !residual_)) {
+            return false;
+        }
+        ep = epilogue;
+        ep.bias = bias ? bias_ : nullptr;
+        ep.residual = residual ? residual_ : nullptr;
+        return true;
+    }
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
 
 infiniStatus_t Descriptor::create(
-    infiniopHandle_t handle_,
+    infiniopHandle_t handle,
     Descriptor **desc_ptr,
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    return createEpilogue(handle, desc_ptr, c_desc, a_desc, b_desc, nullptr, nullptr, INFINIOP_ACTIVATION_NONE);
+}
+
+infiniStatus_t Descriptor::createEpilogue(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t b_desc,
+    infiniopTensorDescriptor_t bias_desc,
+    infiniopTensorDescriptor_t residual_desc,
+    infiniopActivation_t activation) {
     auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
     auto dtype = c_desc->dtype();
 
@@ -18,55 +55,79 @@ infiniStatus_t Descriptor::create(
 
     auto result = MatmulInfo::create(c_desc, a_desc, b_desc, MatrixLayout::COL_MAJOR);
     CHECK_RESULT(result);
+    auto info = result.take();
+
+    // 后处理的步长按用户的 C 给出，MatmulInfo 转置了 C 时行列互换
+    Epilogue epilogue;
+    switch (activation) {
+    case INFINIOP_ACTIVATION_NONE:
+        epilogue.activation = Activation::NONE;
+        break;
+    case INFINIOP_ACTIVATION_RELU:
+        epilogue.activation = Activation::RELU;
+        break;
+    case INFINIOP_ACTIVATION_SILU:
+        epilogue.activation = Activation::SILU;
+        break;
+    case INFINIOP_ACTIVATION_GELU:
+        epilogue.activation = Activation::GELU;
+        break;
+    default:
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    const size_t ndim = c_desc->ndim();
+    if (bias_desc) {
+        if (bias_desc->dtype() != dtype) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        if (bias_desc->ndim() != 1 || bias_desc->dim(0) != c_desc->dim(ndim - 1)) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        epilogue.bias_cs = bias_desc->stride(0);
+    }
+    if (residual_desc) {
+        if (residual_desc->dtype() != dtype) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        CHECK_SAME_SHAPE(residual_desc->shape(), c_desc->shape());
+        epilogue.residual_rs = residual_desc->stride(ndim - 2);
+        epilogue.residual_cs = residual_desc->stride(ndim - 1);
+        epilogue.residual_bs = ndim == 3 && info.batch > 1 ? residual_desc->stride(0) : 0;
+    }
+    if (info.is_transed) {
+        epilogue = epilogue.transposed();
+    }
+
+    // 按调优缓存（若有）选择 GEMV 路径或分块引擎的分块大小
+    auto tuned = tunedConfig(dtype, info);
+    size_t workspace_size = tuned.gemv ? gemvWorkspaceSize(info) : 0;
 
     *desc_ptr = new Descriptor(
-        dtype, result.take(), 0,
-        nullptr,
+        dtype, info, workspace_size,
+        new Opaque{tuned.config, tuned.gemv, epilogue, bias_desc != nullptr, residual_desc != nullptr},
         handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
 
 template <typename Tdata>
-void calculate(
+infiniStatus_t compute(
     const MatmulInfo &info,
+    const BlockConfig &config,
+    bool use_gemv,
+    void *workspace,
     void *c,
     float beta,
     const void *a,
     const void *b,
-    float alpha) {
-    if (info.is_transed) {
-        std::swap(a, b);
-    }
-
-#pragma omp parallel for
-    for (ptrdiff_t index = 0; index < ptrdiff_t(info.batch * info.m * info.n); ++index) {
-        size_t ind = index;
-        size_t n_ = ind % info.n;
-        ind /= info.n;
-        size_t m_ = ind % info.m;
-        ind /= info.m;
-        size_t i = ind;
-        auto c_ = reinterpret_cast<Tdata *>(c) + i * info.c_matrix.stride + m_ * info.c_matrix.row_stride + n_ * info.c_matrix.col_stride;
-        float sum = 0;
-        for (int k_ = 0; k_ < static_cast<int>(info.k); ++k_) {
-            auto a_ = reinterpret_cast<const Tdata *>(a) + i * info.a_matrix.stride + m_ * info.a_matrix.row_stride + k_ * info.a_matrix.col_stride;
-            auto b_ = reinterpret_cast<const Tdata *>(b) + i * info.b_matrix.stride + n_ * info.b_matrix.col_stride + k_ * info.b_matrix.row_stride;
-            if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
-                sum += utils::cast<float>(*a_) * utils::cast<float>(*b_);
-            } else {
-                sum += *a_ * (*b_);
-            }
-        }
-        if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
-            if (beta == 0) {
-                *c_ = utils::cast<Tdata>(alpha * sum);
-            } else {
-                *c_ = utils::cast<Tdata>(beta * utils::cast<float>(*c_) + alpha * sum);
-            }
-        } else {
-            *c_ = beta * (*c_) + alpha * sum;
-        }
+    float alpha,
+    const void *packed_b,
+    const Epilogue &epilogue) {
+    if (use_gemv) {
+        gemv<Tdata>(info, workspace, c, beta, a, b, alpha, packed_b, epilogue);
+    } else {
+        gemm<Tdata>(info, config, c, beta, a, b, alpha, packed_b, epilogue);
     }
+    return INFINI_STATUS_SUCCESS;
 }
 
 infiniStatus_t Descriptor::calculate(
@@ -78,18 +139,74 @@ infiniStatus_t Descriptor::calculate(
     const void *b,
     float alpha,
     void *stream) const {
+    return calculateEpilogue(workspace, workspace_size, c, beta, a, b, nullptr, nullptr, alpha);
+}
+
+infiniStatus_t Descriptor::calculateEpilogue(
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    const void *bias,
+    const void *residual,
+    float alpha) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    Epilogue epilogue;
+    if (!_opaque->bind(epilogue, bias, residual)) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
 
     switch (_dtype) {
     case INFINI_DTYPE_F16:
-        cpu::calculate<fp16_t>(_info, c, beta, a, b, alpha);
+        return compute<fp16_t>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, b, alpha, nullptr, epilogue);
+
+    case INFINI_DTYPE_BF16:
+        return compute<bf16_t>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, b, alpha, nullptr, epilogue);
+
+    case INFINI_DTYPE_F32:
+        return compute<float>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, b, alpha, nullptr, epilogue);
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+size_t Descriptor::packedBSize() const {
+    if (_opaque->gemv) {
+        return gemvPackedBSize(_info, infiniSizeOf(_dtype));
+    }
+    return gemmPackedBSize(_info);
+}
+
+template <typename Tdata>
+void prepack(const MatmulInfo &info, const BlockConfig &config, bool use_gemv, void *packed_b, const void *b) {
+    if (use_gemv) {
+        gemvPrepackB<Tdata>(info, packed_b, b);
+    } else {
+        gemmPrepackB<Tdata>(info, config, packed_b, b);
+    }
+}
+
+infiniStatus_t Descriptor::prepackB(
+    void *packed_b,
+    const void *b) const {
+
+    switch (_dtype) {
+    case INFINI_DTYPE_F16:
+        prepack<fp16_t>(_info, _opaque->config, _opaque->gemv, packed_b, b);
         return INFINI_STATUS_SUCCESS;
 
     case INFINI_DTYPE_BF16:
-        cpu::calculate<bf16_t>(_info, c, beta, a, b, alpha);
+        prepack<bf16_t>(_info, _opaque->config, _opaque->gemv, packed_b, b);
         return INFINI_STATUS_SUCCESS;
 
     case INFINI_DTYPE_F32:
-        cpu::calculate<float>(_info, c, beta, a, b, alpha);
+        prepack<float>(_info, _opaque->config, _opaque->gemv, packed_b, b);
         return INFINI_STATUS_SUCCESS;
 
     default:
@@ -97,4 +214,36 @@ infiniStatus_t Descriptor::calculate(
     }
 }
 
+infiniStatus_t Descriptor::calculatePrepacked(
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    float beta,
+    const void *a,
+    const void *packed_b,
+    float alpha) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    Epilogue epilogue;
+    if (!_opaque->bind(epilogue, nullptr, nullptr)) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    switch (_dtype) {
+    case INFINI_DTYPE_F16:
+        return compute<fp16_t>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, nullptr, alpha, packed_b, epilogue);
+
+    case INFINI_DTYPE_BF16:
+        return compute<bf16_t>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, nullptr, alpha, packed_b, epilogue);
+
+    case INFINI_DTYPE_F32:
+        return compute<float>(_info, _opaque->config, _opaque->gemv, workspace, c, beta, a, nullptr, alpha, packed_b, epilogue);
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
 } // namespace op::gemm::cpu
@@ -2,7 +2,55 @@
 #define __GEMM_CPU_H__
 
 #include "../gemm.h"
+#include "infiniop/ops/gemm.h"
 
-DESCRIPTOR(cpu)
+/**
+ * CPU 上可以把常量 B（如模型权重）预先打包为计算时使用的布局，之后的计算跳过打包：
+ *
+ * - `packedBSize`：打包后的字节数；
+ * - `prepackB`：按描述符中 B 的形状与步长打包；
+ * - `calculatePrepacked`：与 `calculate` 相同，但 B 使用打包后的数据。
+ *
+ * 打包结果只对创建它的描述符有效。
+ *
+ * `createEpilogue` 创建带后处理的描述符，C = act(alpha * A * B + beta * C + bias) + residual，
+ * 后处理在每个输出块写回时完成。bias 是长度为 C 的列数的向量，residual 与 C 形状相同，
+ * 二者的类型与 C 相同，可以省略（传空描述符）。
+ * 描述符要求 bias 或 residual 时只能通过 `calculateEpilogue` 计算。
+ */
+DESCRIPTOR(cpu,
+           static infiniStatus_t createEpilogue(
+               infiniopHandle_t handle,
+               Descriptor **desc_ptr,
+               infiniopTensorDescriptor_t c_desc,
+               infiniopTensorDescriptor_t a_desc,
+               infiniopTensorDescriptor_t b_desc,
+               infiniopTensorDescriptor_t bias_desc,
+               infiniopTensorDescriptor_t residual_desc,
+               infiniopActivation_t activation);
+
+           infiniStatus_t calculateEpilogue(
+               void *workspace, size_t workspace_size,
+               void *c,
+               float beta,
+               const void *a,
+               const void *b,
+               const void *bias,
+               const void *residual,
+               float alpha) const;
+
+           size_t packedBSize() const;
+
+           infiniStatus_t prepackB(
+               void *packed_b,
+               const void *b) const;
+
+           infiniStatus_t calculatePrepacked(
+               void *workspace, size_t workspace_size,
+               void *c,
+               float beta,
+               const void *a,
+               const void *packed_b,
+               float alpha) const;)
 
 #endif // __GEMM_CPU_H__
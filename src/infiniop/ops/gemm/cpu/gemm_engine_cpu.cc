@@ -0,0 +1,758 @@
+#include "gemm_engine_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include "../../../devices/cpu/cpu_math.h"
+#include "../../relu/cpu/relu_cpu.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace op::gemm::cpu {
+
+namespace {
+
+/**
+ * 微内核计算一个 MR x NR 的 C 子块：
+ *
+ * C[i + j * ldc] = alpha * sum_p(a[p * MR + i] * b[p * NR + j]) + beta * C[i + j * ldc]
+ *
+ * - `a` 是按 MR 行打包的 A 微面板，`b` 是按 NR 列打包的 B 微面板；
+ * - C 子块按列主序存储，列间距为 `ldc`；
+ * - `beta == 0` 时不读取 C。
+ */
+using MicroKernelFn = void (*)(
+    size_t kc,
+    const float *a,
+    const float *b,
+    float *c,
+    ptrdiff_t ldc,
+    float alpha,
+    float beta);
+
+struct MicroKernel {
+    size_t mr;
+    size_t nr;
+    MicroKernelFn fn;
+};
+
+constexpr size_t MAX_MR = 32;
+constexpr size_t MAX_NR = 12;
+
+template <size_t MR, size_t NR>
+void microKernelGeneric(
+    size_t kc, const float *a, const float *b,
+    float *c, ptrdiff_t ldc, float alpha, float beta) {
+    float acc[NR][MR] = {};
+    for (size_t p = 0; p < kc; ++p) {
+        for (size_t j = 0; j < NR; ++j) {
+            for (size_t i = 0; i < MR; ++i) {
+                acc[j][i] += a[i] * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+    for (size_t j = 0; j < NR; ++j) {
+        float *c_ = c + j * ldc;
+        for (size_t i = 0; i < MR; ++i) {
+            c_[i] = beta == 0 ? alpha * acc[j][i] : alpha * acc[j][i] + beta * c_[i];
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+#define GEMM_REPEAT_6(M) M(0) M(1) M(2) M(3) M(4) M(5)
+#define GEMM_REPEAT_12(M) GEMM_REPEAT_6(M) M(6) M(7) M(8) M(9) M(10) M(11)
+
+// 16 x 6，12 个 ymm 累加器
+INFINIOP_CPU_TARGET("avx2,fma")
+void microKernelAvx2(
+    size_t kc, const float *a, const float *b,
+    float *c, ptrdiff_t ldc, float alpha, float beta) {
+
+#define GEMM_DECLARE(J) __m256 c0_##J = _mm256_setzero_ps(), c1_##J = _mm256_setzero_ps();
+#define GEMM_FMA(J)                               \
+    {                                             \
+        __m256 b_ = _mm256_broadcast_ss(b + J);   \
+        c0_##J = _mm256_fmadd_ps(a0, b_, c0_##J); \
+        c1_##J = _mm256_fmadd_ps(a1, b_, c1_##J); \
+    }
+#define GEMM_STORE(J)                                                 \
+    _mm256_storeu_ps(c + J * ldc, _mm256_mul_ps(alpha_, c0_##J));     \
+    _mm256_storeu_ps(c + J * ldc + 8, _mm256_mul_ps(alpha_, c1_##J));
+#define GEMM_UPDATE(J)                                                                                                          \
+    _mm256_storeu_ps(c + J * ldc, _mm256_fmadd_ps(beta_, _mm256_loadu_ps(c + J * ldc), _mm256_mul_ps(alpha_, c0_##J)));         \
+    _mm256_storeu_ps(c + J * ldc + 8, _mm256_fmadd_ps(beta_, _mm256_loadu_ps(c + J * ldc + 8), _mm256_mul_ps(alpha_, c1_##J)));
+
+    GEMM_REPEAT_6(GEMM_DECLARE)
+    for (size_t p = 0; p < kc; ++p) {
+        __m256 a0 = _mm256_loadu_ps(a);
+        __m256 a1 = _mm256_loadu_ps(a + 8);
+        GEMM_REPEAT_6(GEMM_FMA)
+        a += 16;
+        b += 6;
+    }
+    __m256 alpha_ = _mm256_set1_ps(alpha);
+    if (beta == 0) {
+        GEMM_REPEAT_6(GEMM_STORE)
+    } else {
+        __m256 beta_ = _mm256_set1_ps(beta);
+        GEMM_REPEAT_6(GEMM_UPDATE)
+    }
+
+#undef GEMM_DECLARE
+#undef GEMM_FMA
+#undef GEMM_STORE
+#undef GEMM_UPDATE
+}
+
+// 32 x 12，24 个 zmm 累加器
+INFINIOP_CPU_TARGET("avx512f,avx512dq,avx512bw,avx512vl,avx2,fma")
+void microKernelAvx512(
+    size_t kc, const float *a, const float *b,
+    float *c, ptrdiff_t ldc, float alpha, float beta) {
+
+#define GEMM_DECLARE(J) __m512 c0_##J = _mm512_setzero_ps(), c1_##J = _mm512_setzero_ps();
+#define GEMM_FMA(J)                               \
+    {                                             \
+        __m512 b_ = _mm512_set1_ps(b[J]);         \
+        c0_##J = _mm512_fmadd_ps(a0, b_, c0_##J); \
+        c1_##J = _mm512_fmadd_ps(a1, b_, c1_##J); \
+    }
+#define GEMM_STORE(J)                                                  \
+    _mm512_storeu_ps(c + J * ldc, _mm512_mul_ps(alpha_, c0_##J));      \
+    _mm512_storeu_ps(c + J * ldc + 16, _mm512_mul_ps(alpha_, c1_##J));
+#define GEMM_UPDATE(J)                                                                                                            \
+    _mm512_storeu_ps(c + J * ldc, _mm512_fmadd_ps(beta_, _mm512_loadu_ps(c + J * ldc), _mm512_mul_ps(alpha_, c0_##J)));           \
+    _mm512_storeu_ps(c + J * ldc + 16, _mm512_fmadd_ps(beta_, _mm512_loadu_ps(c + J * ldc + 16), _mm512_mul_ps(alpha_, c1_##J)));
+
+    GEMM_REPEAT_12(GEMM_DECLARE)
+    for (size_t p = 0; p < kc; ++p) {
+        __m512 a0 = _mm512_loadu_ps(a);
+        __m512 a1 = _mm512_loadu_ps(a + 16);
+        GEMM_REPEAT_12(GEMM_FMA)
+        a += 32;
+        b += 12;
+    }
+    __m512 alpha_ = _mm512_set1_ps(alpha);
+    if (beta == 0) {
+        GEMM_REPEAT_12(GEMM_STORE)
+    } else {
+        __m512 beta_ = _mm512_set1_ps(beta);
+        GEMM_REPEAT_12(GEMM_UPDATE)
+    }
+
+#undef GEMM_DECLARE
+#undef GEMM_FMA
+#undef GEMM_STORE
+#undef GEMM_UPDATE
+}
+
+#undef GEMM_REPEAT_12
+#undef GEMM_REPEAT_6
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+const MicroKernel &microKernel() {
+    static const MicroKernel kernel = [] {
+#ifdef INFINIOP_CPU_X86_SIMD
+        if (device::cpu::isa().avx512) {
+            return MicroKernel{32, 12, microKernelAvx512};
+        }
+        if (device::cpu::isa().avx2) {
+            return MicroKernel{16, 6, microKernelAvx2};
+        }
+#endif
+        return MicroKernel{8, 4, microKernelGeneric<8, 4>};
+    }();
+    return kernel;
+}
+
+// 线程私有的 64 字节对齐缓冲区，只增不减，避免每次调用都重新分配打包空间
+float *threadBuffer(size_t slot, size_t size) {
+    thread_local std::vector<float> buffers[2];
+    auto &buffer = buffers[slot];
+    if (buffer.size() < size + 16) {
+        buffer.resize(size + 16);
+    }
+    auto addr = reinterpret_cast<uintptr_t>(buffer.data());
+    return reinterpret_cast<float *>((addr + 63) & ~uintptr_t(63));
+}
+
+size_t roundUp(size_t x, size_t unit) {
+    return CEIL_DIV(x, unit) * unit;
+}
+
+// 打包与写回时逐段转换的元素数
+constexpr size_t CONVERT_CHUNK = 64;
+
+// 读取 n 个间距为 stride 的元素，转换为 fp32 后按间距 ld 写入 dst；源连续时分段整体转换
+template <typename Tdata>
+void scatter(const Tdata *src, ptrdiff_t stride, size_t n, float *dst, size_t ld) {
+    if (stride == 1 && !std::is_same_v<Tdata, float>) {
+        float buf[CONVERT_CHUNK];
+        for (size_t p0 = 0; p0 < n; p0 += CONVERT_CHUNK) {
+            size_t len = std::min(CONVERT_CHUNK, n - p0);
+            utils::convert_n(src + p0, len, buf);
+            for (size_t p = 0; p < len; ++p) {
+                dst[(p0 + p) * ld] = buf[p];
+            }
+        }
+    } else {
+        for (size_t p = 0; p < n; ++p) {
+            dst[p * ld] = utils::cast<float>(src[p * stride]);
+        }
+    }
+}
+
+// 将 A 的 [mc, kc] 块打包为若干 MR 行的微面板，每个 k 连续存放 MR 个元素，不足 MR 行补零
+template <typename Tdata>
+void packA(size_t mc, size_t kc,
+           const Tdata *a, ptrdiff_t rs, ptrdiff_t cs,
+           size_t mr, float *dst) {
+    for (size_t i0 = 0; i0 < mc; i0 += mr) {
+        size_t rows = std::min(mr, mc - i0);
+        const Tdata *src = a + i0 * rs;
+        if (rs == 1) {
+            // 列连续：每个 k 的 MR 个元素整段转换
+            for (size_t p = 0; p < kc; ++p) {
+                utils::convert_n(src + p * cs, rows, dst + p * mr);
+                std::fill(dst + p * mr + rows, dst + (p + 1) * mr, 0.f);
+            }
+        } else {
+            if (rows < mr) {
+                std::fill(dst, dst + kc * mr, 0.f);
+            }
+            for (size_t i = 0; i < rows; ++i) {
+                scatter(src + i * rs, cs, kc, dst + i, mr);
+            }
+        }
+        dst += kc * mr;
+    }
+}
+
+// 将 B 的 [kc, nc] 块打包为若干 NR 列的微面板，每个 k 连续存放 NR 个元素，不足 NR 列补零
+template <typename Tdata>
+void packB(size_t kc, size_t nc,
+           const Tdata *b, ptrdiff_t rs, ptrdiff_t cs,
+           size_t nr, float *dst) {
+    for (size_t j0 = 0; j0 < nc; j0 += nr) {
+        size_t cols = std::min(nr, nc - j0);
+        const Tdata *src = b + j0 * cs;
+        if (cs == 1) {
+            // 行连续：每个 k 的 NR 个元素整段转换
+            for (size_t p = 0; p < kc; ++p) {
+                utils::convert_n(src + p * rs, cols, dst + p * nr);
+                std::fill(dst + p * nr + cols, dst + (p + 1) * nr, 0.f);
+            }
+        } else {
+            if (cols < nr) {
+                std::fill(dst, dst + kc * nr, 0.f);
+            }
+            for (size_t j = 0; j < cols; ++j) {
+                scatter(src + j * cs, rs, kc, dst + j, nr);
+            }
+        }
+        dst += kc * nr;
+    }
+}
+
+// 遍历打包好的 A 块与 B 块，对每个 MR x NR 子块调用微内核；边缘子块先算到临时缓冲区再写回
+void macroKernel(
+    const MicroKernel &kernel,
+    size_t mc, size_t nc, size_t kc,
+    const float *pa, const float *pb,
+    float *c, ptrdiff_t ldc,
+    float alpha, float beta) {
+    const size_t mr = kernel.mr, nr = kernel.nr;
+    for (size_t j = 0; j < nc; j += nr) {
+        size_t cols = std::min(nr, nc - j);
+        for (size_t i = 0; i < mc; i += mr) {
+            size_t rows = std::min(mr, mc - i);
+            const float *a_ = pa + i * kc;
+            const float *b_ = pb + j * kc;
+            float *c_ = c + i + j * ldc;
+            if (rows == mr && cols == nr) {
+                kernel.fn(kc, a_, b_, c_, ldc, alpha, beta);
+            } else {
+                float tile[MAX_MR * MAX_NR];
+                kernel.fn(kc, a_, b_, tile, mr, 1.f, 0.f);
+                for (size_t jj = 0; jj < cols; ++jj) {
+                    for (size_t ii = 0; ii < rows; ++ii) {
+                        float val = alpha * tile[ii + jj * mr];
+                        c_[ii + jj * ldc] = beta == 0 ? val : val + beta * c_[ii + jj * ldc];
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace {
+
+// 读取 n 个间距为 stride 的元素到连续的 fp32 缓冲区，n 不超过 CONVERT_CHUNK
+template <typename Tdata>
+void gather(const Tdata *src, ptrdiff_t stride, size_t n, float *dst) {
+    if (stride == 1) {
+        utils::convert_n(src, n, dst);
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = utils::cast<float>(src[i * stride]);
+        }
+    }
+}
+
+/**
+ * 对第 j 列从第 i0 行开始的 len（不超过 CONVERT_CHUNK）个 fp32 结果应用后处理，
+ * 下标相对于 `ep` 的原点。
+ */
+template <typename Tdata>
+void applyEpilogue(const Epilogue &ep, size_t i0, size_t j, float *buf, size_t len) {
+    float tmp[CONVERT_CHUNK];
+    if (ep.bias) {
+        auto bias = reinterpret_cast<const Tdata *>(ep.bias) + i0 * ep.bias_rs + j * ep.bias_cs;
+        if (ep.bias_rs == 0) {
+            const float b = utils::cast<float>(*bias);
+            for (size_t i = 0; i < len; ++i) {
+                buf[i] += b;
+            }
+        } else {
+            gather(bias, ep.bias_rs, len, tmp);
+            for (size_t i = 0; i < len; ++i) {
+                buf[i] += tmp[i];
+            }
+        }
+    }
+    switch (ep.activation) {
+    case Activation::RELU:
+        for (size_t i = 0; i < len; ++i) {
+            buf[i] = op::relu::cpu::ReluOp{}(buf[i]);
+        }
+        break;
+    case Activation::SILU:
+        device::cpu::math::silu(buf, buf, len);
+        break;
+    case Activation::GELU:
+        device::cpu::math::gelu(buf, buf, len);
+        break;
+    case Activation::NONE:
+        break;
+    }
+    if (ep.residual) {
+        auto residual = reinterpret_cast<const Tdata *>(ep.residual) + i0 * ep.residual_rs + j * ep.residual_cs;
+        gather(residual, ep.residual_rs, len, tmp);
+        for (size_t i = 0; i < len; ++i) {
+            buf[i] += tmp[i];
+        }
+    }
+}
+
+} // namespace
+
+template <typename Tdata>
+void writeBack(
+    size_t mc, size_t nc,
+    const float *acc, ptrdiff_t ldacc,
+    Tdata *c, ptrdiff_t rs, ptrdiff_t cs,
+    float alpha, float beta,
+    const Epilogue *epilogue) {
+    if (epilogue && epilogue->empty()) {
+        epilogue = nullptr;
+    }
+    for (size_t j = 0; j < nc; ++j) {
+        const float *acc_ = acc + j * ldacc;
+        Tdata *c_ = c + j * cs;
+        if (rs != 1 && !epilogue) {
+            for (size_t i = 0; i < mc; ++i) {
+                float val = alpha * acc_[i];
+                if (beta != 0) {
+                    val += beta * utils::cast<float>(c_[i * rs]);
+                }
+                c_[i * rs] = utils::cast<Tdata>(val);
+            }
+            continue;
+        }
+        float buf[CONVERT_CHUNK];
+        for (size_t i0 = 0; i0 < mc; i0 += CONVERT_CHUNK) {
+            size_t len = std::min(CONVERT_CHUNK, mc - i0);
+            if (beta == 0) {
+                for (size_t i = 0; i < len; ++i) {
+                    buf[i] = alpha * acc_[i0 + i];
+                }
+            } else {
+                gather(c_ + i0 * rs, rs, len, buf);
+                for (size_t i = 0; i < len; ++i) {
+                    buf[i] = alpha * acc_[i0 + i] + beta * buf[i];
+                }
+            }
+            if (epilogue) {
+                applyEpilogue<Tdata>(*epilogue, i0, j, buf, len);
+            }
+            if (rs == 1) {
+                utils::convert_n(buf, len, c_ + i0);
+            } else {
+                for (size_t i = 0; i < len; ++i) {
+                    c_[(i0 + i) * rs] = utils::cast<Tdata>(buf[i]);
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+// C = beta * C（再应用后处理），用于 k == 0 的退化情况
+template <typename Tdata>
+void scaleC(const MatmulInfo &info, Tdata *c, float beta, const Epilogue &epilogue) {
+    const auto &cm = info.c_matrix;
+    const std::vector<float> zeros(info.m, 0.f);
+    for (size_t i = 0; i < info.batch; ++i) {
+        const auto ep = epilogue.at<Tdata>(i, 0, 0);
+        writeBack(info.m, info.n, zeros.data(), 0, c + i * cm.stride, cm.row_stride, cm.col_stride, 0.f, beta, &ep);
+    }
+}
+
+int maxThreads() {
+#ifdef ENABLE_OMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+size_t blockDepth(const BlockConfig &config, size_t k) {
+    return std::min(std::max<size_t>(config.kc, 1), k);
+}
+
+/**
+ * 预打包的 B 的布局。C 按行存放时 MatmulInfo 交换了 A 与 B，此时用户的 B 是内部的 A，
+ * 按 MR 行的面板打包，否则按 NR 列的面板打包。
+ *
+ * 每个批次依次存放各个 kc 块，每个 kc 块存放 `width` 列（或行）的面板，
+ * 因此批次 `i`、k 偏移 `p0`（kc 的倍数）、列偏移 `j0`（NR 的倍数）的面板位于
+ * `(i * k + p0) * width + j0 * kb`，其中 kb 是该 kc 块的深度。
+ */
+struct PackedLayout {
+    bool is_a;
+    size_t batches;
+    size_t width;
+};
+
+PackedLayout packedLayout(const MatmulInfo &info) {
+    const auto &kernel = microKernel();
+    if (info.is_transed) {
+        return {true, info.a_matrix.stride == 0 ? size_t(1) : info.batch, roundUp(info.m, kernel.mr)};
+    }
+    return {false, info.b_matrix.stride == 0 ? size_t(1) : info.batch, roundUp(info.n, kernel.nr)};
+}
+
+/**
+ * 一次 GEMM 在 C 上的二维分块及计算各分块所需的操作数（已按 is_transed 交换 A 与 B）。
+ * 分块按批次、行块、列块的顺序编号，不同分块写入 C 的不同区域，可以并行计算。
+ */
+template <typename Tdata>
+struct TileTask {
+    const MatmulInfo *info;
+    Tdata *c;
+    const Tdata *a, *b;
+    // 预打包的 B，可以为空
+    const float *packed;
+    Epilogue epilogue;
+    size_t kc, mc, nc;
+    size_t tiles_m, tiles_n;
+
+    size_t tiles() const {
+        return info->batch * tiles_m * tiles_n;
+    }
+
+    // 一个分块的乘加次数，用于比较不同任务的分块大小
+    size_t tileWork() const {
+        return mc * nc * info->k;
+    }
+
+    // 将分块切小一半，优先切分 n，再切分 m；无法再切分时返回 false
+    bool split() {
+        const auto &kernel = microKernel();
+        if (nc > 4 * kernel.nr) {
+            nc = roundUp(nc / 2, kernel.nr);
+        } else if (mc > kernel.mr) {
+            mc = roundUp(mc / 2, kernel.mr);
+        } else {
+            return false;
+        }
+        tiles_m = CEIL_DIV(info->m, mc);
+        tiles_n = CEIL_DIV(info->n, nc);
+        return true;
+    }
+};
+
+/**
+ * 为一次 GEMM 生成分块任务追加到 `tasks`，分块大小取 `config` 取整到微内核形状。
+ * C 为空或 k == 0（此时就地完成 C = beta * C）时不生成任务，返回 false。
+ */
+template <typename Tdata>
+bool addTask(
+    std::vector<TileTask<Tdata>> &tasks,
+    const MatmulInfo &info,
+    const BlockConfig &config,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    const void *packed_b,
+    const Epilogue &epilogue) {
+    if (info.m == 0 || info.n == 0 || info.batch == 0) {
+        return false;
+    }
+    if (info.k == 0) {
+        scaleC(info, reinterpret_cast<Tdata *>(c), beta, epilogue);
+        return false;
+    }
+    if (info.is_transed) {
+        std::swap(a, b);
+    }
+    const auto &kernel = microKernel();
+    TileTask<Tdata> task;
+    task.info = &info;
+    task.c = reinterpret_cast<Tdata *>(c);
+    task.a = reinterpret_cast<const Tdata *>(a);
+    task.b = reinterpret_cast<const Tdata *>(b);
+    task.packed = reinterpret_cast<const float *>(packed_b);
+    task.epilogue = epilogue;
+    task.kc = blockDepth(config, info.k);
+    task.mc = std::min(roundUp(info.m, kernel.mr), std::max(config.mc / kernel.mr, size_t(1)) * kernel.mr);
+    task.nc = std::min(roundUp(info.n, kernel.nr), std::max(config.nc / kernel.nr, size_t(1)) * kernel.nr);
+    task.tiles_m = CEIL_DIV(info.m, task.mc);
+    task.tiles_n = CEIL_DIV(info.n, task.nc);
+    tasks.push_back(task);
+    return true;
+}
+
+// 所有任务的分块总数不足线程数时，反复切分分块最大的任务
+template <typename Tdata>
+void balanceTiles(std::vector<TileTask<Tdata>> &tasks, size_t threads) {
+    size_t total = 0;
+    for (const auto &task : tasks) {
+        total += task.tiles();
+    }
+    std::vector<bool> done(tasks.size(), false);
+    while (total < threads) {
+        size_t g = tasks.size();
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            if (!done[i] && (g == tasks.size() || tasks[i].tileWork() > tasks[g].tileWork())) {
+                g = i;
+            }
+        }
+        if (g == tasks.size()) {
+            break;
+        }
+        total -= tasks[g].tiles();
+        done[g] = !tasks[g].split();
+        total += tasks[g].tiles();
+    }
+}
+
+// 计算任务的第 t 个分块：沿 k 逐段打包 A、B 并调用宏内核，最后写回 C 并应用后处理
+template <typename Tdata>
+void computeTile(const TileTask<Tdata> &task, size_t t, float alpha, float beta) {
+    const auto &info = *task.info;
+    const auto &am = info.a_matrix;
+    const auto &bm = info.b_matrix;
+    const auto &cm = info.c_matrix;
+    const size_t m = info.m, n = info.n, k = info.k;
+    const size_t kc = task.kc, mc = task.mc, nc = task.nc;
+
+    const auto &kernel = microKernel();
+    const size_t mr = kernel.mr, nr = kernel.nr;
+
+    // fp32 且 C 按列连续时微内核直接写入 C，否则先在 fp32 暂存区中累加
+    const bool direct = std::is_same_v<Tdata, float> && cm.row_stride == 1;
+
+    // 预打包的 B 对应内部的 A 或 B，对应的操作数不再打包
+    const auto layout = packedLayout(info);
+    const bool packed_a = task.packed && layout.is_a;
+    const bool packed_b = task.packed && !layout.is_a;
+
+    const size_t tn = t % task.tiles_n;
+    const size_t tm = t / task.tiles_n % task.tiles_m;
+    const size_t batch = t / task.tiles_n / task.tiles_m;
+    const size_t i0 = tm * mc, j0 = tn * nc;
+    const size_t mb = std::min(mc, m - i0), nb = std::min(nc, n - j0);
+
+    const Tdata *a_blk = packed_a ? nullptr : task.a + batch * am.stride + i0 * am.row_stride;
+    const Tdata *b_blk = packed_b ? nullptr : task.b + batch * bm.stride + j0 * bm.col_stride;
+    const float *packed_blk = nullptr;
+    if (task.packed) {
+        const size_t packed_batch = layout.batches == 1 ? 0 : batch;
+        packed_blk = task.packed + packed_batch * k * layout.width;
+    }
+    Tdata *c_blk = task.c + batch * cm.stride + i0 * cm.row_stride + j0 * cm.col_stride;
+
+    float *pa = threadBuffer(0, roundUp(mb, mr) * kc + (direct ? 0 : mb * nb));
+    float *pb = threadBuffer(1, roundUp(nb, nr) * kc);
+    float *acc = direct ? reinterpret_cast<float *>(c_blk) : pa + roundUp(mb, mr) * kc;
+    const ptrdiff_t ldacc = direct ? cm.col_stride : ptrdiff_t(mb);
+
+    for (size_t p0 = 0; p0 < k; p0 += kc) {
+        const size_t kb = std::min(kc, k - p0);
+        const float *pa_ = pa, *pb_ = pb;
+        if (packed_b) {
+            pb_ = packed_blk + p0 * layout.width + j0 * kb;
+        } else {
+            packB(kb, nb, b_blk + p0 * bm.row_stride, bm.row_stride, bm.col_stride, nr, pb);
+        }
+        if (packed_a) {
+            pa_ = packed_blk + p0 * layout.width + i0 * kb;
+        } else {
+            packA(mb, kb, a_blk + p0 * am.col_stride, am.row_stride, am.col_stride, mr, pa);
+        }
+        if (direct) {
+            macroKernel(kernel, mb, nb, kb, pa_, pb_, acc, ldacc, alpha, p0 == 0 ? beta : 1.f);
+        } else {
+            macroKernel(kernel, mb, nb, kb, pa_, pb_, acc, ldacc, 1.f, p0 == 0 ? 0.f : 1.f);
+        }
+    }
+    const auto ep = task.epilogue.template at<Tdata>(batch, i0, j0);
+    if (!direct) {
+        writeBack(mb, nb, acc, ldacc, c_blk, cm.row_stride, cm.col_stride, alpha, beta, &ep);
+    } else if (!ep.empty()) {
+        // 直接写入的 C 块仍在缓存中，原地应用后处理
+        for (size_t j = 0; j < nb; ++j) {
+            float *col = acc + j * ldacc;
+            for (size_t i = 0; i < mb; i += CONVERT_CHUNK) {
+                applyEpilogue<Tdata>(ep, i, j, col + i, std::min(CONVERT_CHUNK, mb - i));
+            }
+        }
+    }
+}
+
+} // namespace
+
+BlockConfig defaultBlockConfig(infiniDtype_t dtype) {
+    // 半精度的输出先在 fp32 暂存区中累加，缩小 nc 以使暂存区留在 L2 中
+    if (dtype == INFINI_DTYPE_F16 || dtype == INFINI_DTYPE_BF16) {
+        return BlockConfig{96, 384, 256};
+    }
+    return BlockConfig{96, 1024, 256};
+}
+
+size_t gemmPackedBSize(const MatmulInfo &info) {
+    const auto layout = packedLayout(info);
+    return layout.batches * layout.width * info.k * sizeof(float);
+}
+
+template <typename Tdata>
+void gemmPrepackB(
+    const MatmulInfo &info,
+    const BlockConfig &config,
+    void *packed_b,
+    const void *b_) {
+    const auto layout = packedLayout(info);
+    const size_t k = info.k;
+    if (k == 0 || layout.width == 0) {
+        return;
+    }
+    const auto &kernel = microKernel();
+    const auto &bm = layout.is_a ? info.a_matrix : info.b_matrix;
+    const size_t kc = blockDepth(config, k);
+    const size_t blocks = CEIL_DIV(k, kc);
+    const ptrdiff_t tasks = ptrdiff_t(layout.batches * blocks);
+    auto packed = reinterpret_cast<float *>(packed_b);
+    auto b = reinterpret_cast<const Tdata *>(b_);
+
+#pragma omp parallel for
+    for (ptrdiff_t t = 0; t < tasks; ++t) {
+        const size_t batch = size_t(t) / blocks;
+        const size_t p0 = size_t(t) % blocks * kc;
+        const size_t kb = std::min(kc, k - p0);
+        float *dst = packed + (batch * k + p0) * layout.width;
+        const Tdata *src = b + batch * bm.stride;
+        if (layout.is_a) {
+            packA(info.m, kb, src + p0 * bm.col_stride, bm.row_stride, bm.col_stride, kernel.mr, dst);
+        } else {
+            packB(kb, info.n, src + p0 * bm.row_stride, bm.row_stride, bm.col_stride, kernel.nr, dst);
+        }
+    }
+}
+
+template <typename Tdata>
+void gemm(
+    const MatmulInfo &info,
+    const BlockConfig &config,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    float alpha,
+    const void *packed_b,
+    const Epilogue &epilogue) {
+    std::vector<TileTask<Tdata>> tasks;
+    if (!addTask(tasks, info, config, c, beta, a, b, packed_b, epilogue)) {
+        return;
+    }
+    balanceTiles(tasks, size_t(maxThreads()));
+    const auto &task = tasks.front();
+    const ptrdiff_t tiles = ptrdiff_t(task.tiles());
+
+#pragma omp parallel for schedule(dynamic)
+    for (ptrdiff_t t = 0; t < tiles; ++t) {
+        computeTile(task, size_t(t), alpha, beta);
+    }
+}
+
+template <typename Tdata>
+GroupedWork gemmGroupedWork(
+    const MatmulInfo *infos,
+    size_t count,
+    const BlockConfig *configs,
+    void *const *c,
+    float beta,
+    const void *const *a,
+    const void *const *b,
+    float alpha) {
+    std::vector<TileTask<Tdata>> tasks;
+    for (size_t g = 0; g < count; ++g) {
+        addTask(tasks, infos[g], configs[g], c[g], beta, a[g], b[g], nullptr, Epilogue{});
+    }
+    if (tasks.empty()) {
+        return {};
+    }
+    balanceTiles(tasks, size_t(maxThreads()));
+
+    // 按每个分块的计算量从大到小排列，动态调度时大块先行，尾部由小块填补
+    std::stable_sort(tasks.begin(), tasks.end(), [](const auto &x, const auto &y) {
+        return x.tileWork() > y.tileWork();
+    });
+    // first[g] 是第 g 个任务的第一个分块在全局分块序号中的位置
+    std::vector<size_t> first(tasks.size() + 1, 0);
+    for (size_t g = 0; g < tasks.size(); ++g) {
+        first[g + 1] = first[g] + tasks[g].tiles();
+    }
+    const size_t tiles = first.back();
+
+    return {tiles, [tasks = std::move(tasks), first = std::move(first), alpha, beta](size_t t) {
+                const size_t g = size_t(std::upper_bound(first.begin() + 1, first.end(), t) - first.begin() - 1);
+                computeTile(tasks[g], t - first[g], alpha, beta);
+            }};
+}
+
+template void gemm<fp16_t>(const MatmulInfo &, const BlockConfig &, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+template void gemm<bf16_t>(const MatmulInfo &, const BlockConfig &, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+template void gemm<float>(const MatmulInfo &, const BlockConfig &, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+
+template GroupedWork gemmGroupedWork<fp16_t>(const MatmulInfo *, size_t, const BlockConfig *, void *const *, float, const void *const *, const void *const *, float);
+template GroupedWork gemmGroupedWork<bf16_t>(const MatmulInfo *, size_t, const BlockConfig *, void *const *, float, const void *const *, const void *const *, float);
+template GroupedWork gemmGroupedWork<float>(const MatmulInfo *, size_t, const BlockConfig *, void *const *, float, const void *const *, const void *const *, float);
+
+template void gemmPrepackB<fp16_t>(const MatmulInfo &, const BlockConfig &, void *, const void *);
+template void gemmPrepackB<bf16_t>(const MatmulInfo &, const BlockConfig &, void *, const void *);
+template void gemmPrepackB<float>(const MatmulInfo &, const BlockConfig &, void *, const void *);
+
+template void writeBack<fp16_t>(size_t, size_t, const float *, ptrdiff_t, fp16_t *, ptrdiff_t, ptrdiff_t, float, float, const Epilogue *);
+template void writeBack<bf16_t>(size_t, size_t, const float *, ptrdiff_t, bf16_t *, ptrdiff_t, ptrdiff_t, float, float, const Epilogue *);
+template void writeBack<float>(size_t, size_t, const float *, ptrdiff_t, float *, ptrdiff_t, ptrdiff_t, float, float, const Epilogue *);
+
+} // namespace op::gemm::cpu
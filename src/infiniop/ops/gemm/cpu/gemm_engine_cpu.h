@@ -0,0 +1,165 @@
+#ifndef __GEMM_ENGINE_CPU_H__
+#define __GEMM_ENGINE_CPU_H__
+
+#include "../info.h"
+#include <functional>
+
+namespace op::gemm::cpu {
+
+/**
+ * Cache blocking parameters of the packed GEMM engine.
+ *
+ * - `kc`: depth of the packed panels, a micro-panel of A and of B stays in L1;
+ * - `mc`: rows of the packed block of A, which stays in L2;
+ * - `nc`: columns of the packed block of B, which stays in L2/L3.
+ *
+ * `mc` and `nc` are upper bounds: the engine shrinks them to create enough
+ * 2D tiles for all threads, and rounds them to the micro-kernel tile shape.
+ */
+struct BlockConfig {
+    size_t mc;
+    size_t nc;
+    size_t kc;
+};
+
+BlockConfig defaultBlockConfig(infiniDtype_t dtype);
+
+enum class Activation : char {
+    NONE,
+    RELU,
+    SILU,
+    GELU,
+};
+
+/**
+ * Epilogue applied to every output element before it is stored:
+ * `C[i, j] = act(alpha * (A * B)[i, j] + beta * C[i, j] + bias[i, j]) + residual[i, j]`.
+ *
+ * `bias` and `residual` have the element type of C and are indexed like C,
+ * in the coordinates of `MatmulInfo` (after any transposition), with element
+ * strides: a bias vector over the columns of the user's C has one zero stride.
+ * A null pointer disables the corresponding term.
+ */
+struct Epilogue {
+    Activation activation = Activation::NONE;
+    const void *bias = nullptr;
+    ptrdiff_t bias_rs = 0, bias_cs = 0;
+    const void *residual = nullptr;
+    ptrdiff_t residual_rs = 0, residual_cs = 0, residual_bs = 0;
+
+    bool empty() const {
+        return activation == Activation::NONE && bias == nullptr && residual == nullptr;
+    }
+
+    // 行列互换后的后处理，用于以 C^T 计算的路径
+    Epilogue transposed() const {
+        Epilogue ans = *this;
+        std::swap(ans.bias_rs, ans.bias_cs);
+        std::swap(ans.residual_rs, ans.residual_cs);
+        return ans;
+    }
+
+    // 原点移动到第 batch 批、第 i 行、第 j 列的后处理
+    template <typename Tdata>
+    Epilogue at(size_t batch, size_t i, size_t j) const {
+        Epilogue ans = *this;
+        if (bias) {
+            ans.bias = reinterpret_cast<const Tdata *>(bias) + i * bias_rs + j * bias_cs;
+        }
+        if (residual) {
+            ans.residual = reinterpret_cast<const Tdata *>(residual) + batch * residual_bs + i * residual_rs + j * residual_cs;
+        }
+        return ans;
+    }
+};
+
+/**
+ * Compute `C = alpha * A * B + beta * C` for every batch described by `info`.
+ *
+ * A, B and C have element type `Tdata` and arbitrary row/col strides; the
+ * operands are packed into fp32 panels and accumulated in fp32.
+ * When `beta == 0`, C is not read.
+ *
+ * If `packed_b` is not null it holds B as written by `gemmPrepackB` with the
+ * same `info` and `config`, and `b` is ignored.
+ *
+ * A non-empty `epilogue` is applied to each output tile while it is stored.
+ */
+template <typename Tdata>
+void gemm(
+    const MatmulInfo &info,
+    const BlockConfig &config,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    float alpha,
+    const void *packed_b = nullptr,
+    const Epilogue &epilogue = {});
+
+/**
+ * Independent units of work of a grouped call. It is built outside any parallel
+ * region. `run(t)` computes unit `t < units` and may be called concurrently for
+ * different units, so the work of several `GroupedWork` can share one parallel
+ * region.
+ */
+struct GroupedWork {
+    size_t units = 0;
+    std::function<void(size_t)> run;
+};
+
+/**
+ * Work computing `C[g] = alpha * A[g] * B[g] + beta * C[g]` for each group
+ * `g < count`, described by `infos[g]`, blocked with `configs[g]` and stored at
+ * `c[g]`, `a[g]`, `b[g]`.
+ *
+ * One unit is one output tile. Tiles of all groups are ordered largest first,
+ * so many small GEMMs of different shapes keep all threads busy together under
+ * dynamic scheduling.
+ */
+template <typename Tdata>
+GroupedWork gemmGroupedWork(
+    const MatmulInfo *infos,
+    size_t count,
+    const BlockConfig *configs,
+    void *const *c,
+    float beta,
+    const void *const *a,
+    const void *const *b,
+    float alpha);
+
+/**
+ * Size in bytes of B packed into the fp32 panels consumed by `gemm`.
+ */
+size_t gemmPackedBSize(const MatmulInfo &info);
+
+/**
+ * Pack B (every batch that is not broadcast) into `packed_b`, which must hold
+ * `gemmPackedBSize(info)` bytes and should be 64-byte aligned.
+ */
+template <typename Tdata>
+void gemmPrepackB(
+    const MatmulInfo &info,
+    const BlockConfig &config,
+    void *packed_b,
+    const void *b);
+
+/**
+ * Store an fp32 accumulator block: `C[i, j] = alpha * acc[i + j * ldacc] + beta * C[i, j]`
+ * for `i < mc`, `j < nc`, where C has element strides `rs`/`cs`.
+ * When `beta == 0`, C is not read.
+ *
+ * If `epilogue` is not null, its origin is the first element of the block
+ * (see `Epilogue::at`) and it is applied before the values are narrowed.
+ */
+template <typename Tdata>
+void writeBack(
+    size_t mc, size_t nc,
+    const float *acc, ptrdiff_t ldacc,
+    Tdata *c, ptrdiff_t rs, ptrdiff_t cs,
+    float alpha, float beta,
+    const Epilogue *epilogue = nullptr);
+
+} // namespace op::gemm::cpu
+
+#endif // __GEMM_ENGINE_CPU_H__
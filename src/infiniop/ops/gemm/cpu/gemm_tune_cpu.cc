@@ -0,0 +1,291 @@
+#include "gemm_tune_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include "gemv_cpu.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace op::gemm::cpu {
+
+namespace {
+
+// 缓存文件的第一行，读取时与其他以 # 开头的行一起忽略
+constexpr const char *CACHE_HEADER = "# infiniop gemm tuning cache: machine dtype m n k batch layout (gemv | gemm mc nc kc)";
+
+// 候选的分块大小，引擎会将其取整到微内核形状并截断到矩阵大小
+constexpr BlockConfig CANDIDATES[] = {
+    {96, 384, 256},
+    {96, 1024, 256},
+    {48, 384, 256},
+    {192, 384, 256},
+    {96, 256, 128},
+    {96, 512, 384},
+    {144, 768, 256},
+    {96, 2048, 256},
+    {48, 1024, 512},
+    {192, 1024, 128},
+};
+
+// 每个候选计时的次数，取最快的一次
+constexpr int TUNE_RUNS = 3;
+
+const char *isaName() {
+    const auto &isa = device::cpu::isa();
+    return isa.avx512 ? "avx512" : isa.avx2 ? "avx2"
+                                            : "scalar";
+}
+
+/**
+ * 机器指纹，作为键的第一项：ISA、L1d/L2/L3 缓存大小与线程数，例如 `avx512,l1d=48k,l2=2048k,l3=107520k,threads=8`。
+ * 最优的分块取决于这些参数，从其他机器复制来的缓存文件或改变 OMP_NUM_THREADS 后不会命中，退回默认选择。
+ * sysconf 不提供缓存大小的平台（如 Windows）上指纹只含 ISA 与线程数。
+ */
+std::string machineKey() {
+    std::ostringstream key;
+    key << isaName();
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+    const std::pair<const char *, int> levels[] = {
+        {"l1d", _SC_LEVEL1_DCACHE_SIZE},
+        {"l2", _SC_LEVEL2_CACHE_SIZE},
+        {"l3", _SC_LEVEL3_CACHE_SIZE},
+    };
+    for (const auto &[name, level] : levels) {
+        key << ',' << name << '=' << std::max(sysconf(level), 0L) / 1024 << 'k';
+    }
+#endif
+#ifdef ENABLE_OMP
+    key << ",threads=" << omp_get_max_threads();
+#else
+    key << ",threads=1";
+#endif
+    return key.str();
+}
+
+// 操作数的布局：内部的 A、B、C 各自按列（c）或按行（r）连续
+std::string shapeKey(infiniDtype_t dtype, const MatmulInfo &info) {
+    auto layout = [](const BlasMatrix &matrix) { return matrix.row_stride == 1 ? 'c' : 'r'; };
+    std::ostringstream key;
+    key << machineKey() << ' ' << int(dtype) << ' '
+        << info.m << ' ' << info.n << ' ' << info.k << ' ' << info.batch << ' '
+        << layout(info.a_matrix) << layout(info.b_matrix) << layout(info.c_matrix);
+    return key.str();
+}
+
+std::string formatResult(const TuneResult &result) {
+    std::ostringstream value;
+    if (result.gemv) {
+        value << "gemv";
+    } else {
+        value << "gemm " << result.config.mc << ' ' << result.config.nc << ' ' << result.config.kc;
+    }
+    return value.str();
+}
+
+class TuningCache {
+    std::mutex _mutex;
+    std::map<std::string, TuneResult> _entries;
+    std::string _path;
+    bool _tune;
+
+    // 解析一行缓存，格式为 `key... gemv` 或 `key... gemm mc nc kc`，key 由 7 项组成
+    void parse(const std::string &line) {
+        std::istringstream in(line);
+        std::string token, key;
+        for (int i = 0; i < 7; ++i) {
+            if (!(in >> token)) {
+                return;
+            }
+            key += (i ? " " : "") + token;
+        }
+        TuneResult result{};
+        if (!(in >> token)) {
+            return;
+        }
+        if (token == "gemv") {
+            result.gemv = true;
+        } else if (token != "gemm" || !(in >> result.config.mc >> result.config.nc >> result.config.kc)) {
+            return;
+        }
+        _entries[key] = result;
+    }
+
+public:
+    TuningCache() {
+        const char *path = std::getenv("INFINIOP_GEMM_TUNING_CACHE");
+        const char *tune = std::getenv("INFINIOP_GEMM_TUNE");
+        _path = path ? path : "";
+        _tune = tune && std::string(tune) == "1";
+        if (_path.empty()) {
+            return;
+        }
+        std::ifstream file(_path);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (!line.empty() && line[0] != '#') {
+                parse(line);
+            }
+        }
+    }
+
+    bool tune() const {
+        return _tune;
+    }
+
+    bool find(const std::string &key, TuneResult &result) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(key);
+        if (it == _entries.end()) {
+            return false;
+        }
+        result = it->second;
+        return true;
+    }
+
+    // 记录调优结果，并追加到缓存文件中（新文件先写入表头）
+    void insert(const std::string &key, const TuneResult &result) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_entries.emplace(key, result).second || _path.empty()) {
+            return;
+        }
+        const bool exists = std::ifstream(_path).good();
+        std::ofstream file(_path, std::ios::app);
+        if (!exists) {
+            file << CACHE_HEADER << '\n';
+        }
+        file << key << ' ' << formatResult(result) << '\n';
+    }
+};
+
+TuningCache &cache() {
+    static TuningCache instance;
+    return instance;
+}
+
+// 矩阵覆盖的元素数，步长为负时返回 0
+size_t matrixSpan(const BlasMatrix &matrix, size_t batch) {
+    if (matrix.stride < 0 || matrix.row_stride < 0 || matrix.col_stride < 0) {
+        return 0;
+    }
+    size_t span = 1;
+    if (matrix.rows && matrix.cols) {
+        span += (matrix.rows - 1) * size_t(matrix.row_stride) + (matrix.cols - 1) * size_t(matrix.col_stride);
+    }
+    if (matrix.stride != 0) {
+        span += (batch - 1) * size_t(matrix.stride);
+    }
+    return span;
+}
+
+double seconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * 在临时缓冲区上对 info 逐个测量候选方案，返回最快的一个。
+ * 缓冲区按 info 的步长分配，A、B 取两者中较大的大小，以免关心 is_transed 是否交换了二者。
+ */
+template <typename Tdata>
+TuneResult benchmark(const MatmulInfo &info, const TuneResult &fallback) {
+    const size_t span_a = matrixSpan(info.a_matrix, info.batch);
+    const size_t span_b = matrixSpan(info.b_matrix, info.batch);
+    const size_t span_c = matrixSpan(info.c_matrix, info.batch);
+    if (span_a == 0 || span_b == 0 || span_c == 0 || info.k == 0) {
+        return fallback;
+    }
+    std::vector<Tdata> a(std::max(span_a, span_b)), b(a.size()), c(span_c);
+    std::vector<char> workspace(gemvSupported(info) ? gemvWorkspaceSize(info) : 0);
+
+    std::vector<TuneResult> candidates;
+    if (gemvSupported(info)) {
+        candidates.push_back({fallback.config, true});
+    }
+    // 按截断后的实际分块去重
+    auto effective = [&](const BlockConfig &config) {
+        return std::make_tuple(std::min(config.mc, info.m), std::min(config.nc, info.n), std::min(config.kc, info.k));
+    };
+    for (const auto &config : CANDIDATES) {
+        const bool duplicate = std::any_of(candidates.begin(), candidates.end(), [&](const TuneResult &other) {
+            return !other.gemv && effective(other.config) == effective(config);
+        });
+        if (!duplicate) {
+            candidates.push_back({config, false});
+        }
+    }
+
+    TuneResult best = fallback;
+    double best_time = 0;
+    for (const auto &candidate : candidates) {
+        auto run = [&] {
+            if (candidate.gemv) {
+                gemv<Tdata>(info, workspace.data(), c.data(), 0.f, a.data(), b.data(), 1.f);
+            } else {
+                gemm<Tdata>(info, candidate.config, c.data(), 0.f, a.data(), b.data(), 1.f);
+            }
+        };
+        // 第一次运行用于预热缓存与线程池
+        run();
+        double time = 0;
+        for (int i = 0; i < TUNE_RUNS; ++i) {
+            const double start = seconds();
+            run();
+            const double elapsed = seconds() - start;
+            time = i == 0 ? elapsed : std::min(time, elapsed);
+        }
+        if (best_time == 0 || time < best_time) {
+            best = candidate;
+            best_time = time;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+TuneResult tunedConfig(infiniDtype_t dtype, const MatmulInfo &info) {
+    const TuneResult fallback{defaultBlockConfig(dtype), gemvSupported(info)};
+    auto &tuning = cache();
+    const auto key = shapeKey(dtype, info);
+
+    TuneResult result;
+    if (tuning.find(key, result)) {
+        // 缓存文件可能来自其他版本，GEMV 不支持的形状退回默认选择
+        if (result.gemv && !gemvSupported(info)) {
+            return fallback;
+        }
+        if (result.gemv) {
+            result.config = fallback.config;
+        }
+        return result;
+    }
+    if (!tuning.tune()) {
+        return fallback;
+    }
+
+    switch (dtype) {
+    case INFINI_DTYPE_F16:
+        result = benchmark<fp16_t>(info, fallback);
+        break;
+    case INFINI_DTYPE_BF16:
+        result = benchmark<bf16_t>(info, fallback);
+        break;
+    case INFINI_DTYPE_F32:
+        result = benchmark<float>(info, fallback);
+        break;
+    default:
+        return fallback;
+    }
+    tuning.insert(key, result);
+    return result;
+}
+
+} // namespace op::gemm::cpu
@@ -0,0 +1,41 @@
+#ifndef __GEMM_TUNE_CPU_H__
+#define __GEMM_TUNE_CPU_H__
+
+#include "gemm_engine_cpu.h"
+
+namespace op::gemm::cpu {
+
+/**
+ * Kernel choice for one GEMM shape: the GEMV path, or the packed engine with
+ * the given block sizes.
+ */
+struct TuneResult {
+    BlockConfig config;
+    bool gemv;
+};
+
+/**
+ * Kernel choice for `info`, as consulted by `Descriptor::create` and, for each
+ * group, by the grouped GEMM descriptor.
+ *
+ * Without tuning this is `defaultBlockConfig` and the GEMV path for every
+ * shape accepted by `gemvSupported`. Tuning is controlled by two environment
+ * variables:
+ *
+ * - `INFINIOP_GEMM_TUNING_CACHE`: path of a tuning cache file, loaded on first
+ *   use; shapes found in it use the recorded choice;
+ * - `INFINIOP_GEMM_TUNE=1`: shapes missing from the cache are benchmarked over
+ *   a set of candidate configurations, and the fastest is kept for the process
+ *   and appended to the cache file, if any. The benchmark runs synchronously
+ *   inside `Descriptor::create`, which then takes as long as timing every
+ *   candidate a few times on the full shape.
+ *
+ * Cache entries are keyed by a machine fingerprint (ISA, L1d/L2/L3 cache sizes
+ * and OpenMP thread count), dtype, m, n, k, batch and operand layouts; entries
+ * recorded on another machine or with another thread count are not used.
+ */
+TuneResult tunedConfig(infiniDtype_t dtype, const MatmulInfo &info);
+
+} // namespace op::gemm::cpu
+
+#endif // __GEMM_TUNE_CPU_H__
@@ -0,0 +1,642 @@
+#include "gemv_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include "gemm_engine_cpu.h"
+#include <algorithm>
+
+namespace op::gemm::cpu {
+
+namespace {
+
+/**
+ * GEMV 问题统一写成 Y[i, t] = sum_p W[i, p] * X[p, t]：
+ *
+ * - W 是 rows x k 的权重矩阵，每个元素只读取一次；
+ * - X 是 k x s 的小矩阵（s <= GEMV_MAX_COLS），预先转换为 fp32 并补零到 S 列；
+ * - n 较小时 W = A、X = B、Y = C；m 较小时 W = B^T、X = A^T、Y = C^T。
+ *
+ * W 按 k 连续时逐行做点积（dot 形式），按行连续时逐个 k 做 axpy（axpy 形式）。
+ */
+struct Problem {
+    size_t rows, k, s;
+    const void *w;
+    ptrdiff_t w_rs, w_cs, w_bs;
+    const void *x;
+    ptrdiff_t x_ps, x_ts, x_bs;
+    void *y;
+    ptrdiff_t y_rs, y_cs, y_bs;
+};
+
+Problem makeProblem(const MatmulInfo &info, void *c, const void *a, const void *b) {
+    const auto &am = info.a_matrix;
+    const auto &bm = info.b_matrix;
+    const auto &cm = info.c_matrix;
+    if (info.n <= info.m) {
+        return {info.m, info.k, info.n,
+                a, am.row_stride, am.col_stride, am.stride,
+                b, bm.row_stride, bm.col_stride, bm.stride,
+                c, cm.row_stride, cm.col_stride, cm.stride};
+    }
+    return {info.n, info.k, info.m,
+            b, bm.col_stride, bm.row_stride, bm.stride,
+            a, am.col_stride, am.row_stride, am.stride,
+            c, cm.col_stride, cm.row_stride, cm.stride};
+}
+
+// X 补零后的列数，只为 1、2、4、8 列生成内核
+size_t paddedCols(size_t s) {
+    return s <= 1 ? 1 : s <= 2 ? 2
+                    : s <= 4   ? 4
+                               : 8;
+}
+
+size_t colsIndex(size_t cols) {
+    return cols == 1 ? 0 : cols == 2 ? 1
+                       : cols == 4   ? 2
+                                     : 3;
+}
+
+// 每个任务负责的 W 行数上限，axpy 形式下 tile 需留在 L1 中
+constexpr size_t GEMV_BLOCK = 1024;
+
+// axpy 形式下同时读取的 W 的行数
+constexpr size_t AXPY_ROWS = 4;
+
+// 通用实现中逐段转换 W 的元素数
+constexpr size_t CONVERT_CHUNK = 64;
+
+/**
+ * 计算 W 的 rows 行与 X 的乘积，结果写入 tile[i + t * rows]（t < S）。
+ *
+ * - dot 形式：`ld` 是 W 的行间距，X 按 [S][k] 存放；
+ * - axpy 形式：`ld` 是 W 的列间距，X 按 [k][S] 存放。
+ */
+template <typename Tdata>
+using BlockFn = void (*)(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile);
+
+template <typename Tdata>
+struct Kernels {
+    BlockFn<Tdata> dot[4];
+    BlockFn<Tdata> axpy[4];
+};
+
+template <typename Tdata, size_t S>
+void dotBlockGeneric(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    float buf[CONVERT_CHUNK];
+    for (size_t r = 0; r < rows; ++r) {
+        float sum[S] = {};
+        for (size_t p0 = 0; p0 < k; p0 += CONVERT_CHUNK) {
+            size_t len = std::min(CONVERT_CHUNK, k - p0);
+            utils::convert_n(w + r * ld + p0, len, buf);
+            for (size_t t = 0; t < S; ++t) {
+                for (size_t p = 0; p < len; ++p) {
+                    sum[t] += buf[p] * x[t * k + p0 + p];
+                }
+            }
+        }
+        for (size_t t = 0; t < S; ++t) {
+            tile[r + t * rows] = sum[t];
+        }
+    }
+}
+
+// axpy 形式：按 k 逐行连续读取 W，累加到留在缓存中的 tile
+template <typename Tdata, size_t S>
+void axpyBlockGeneric(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    std::fill(tile, tile + rows * S, 0.f);
+    float buf[CONVERT_CHUNK];
+    for (size_t p = 0; p < k; ++p) {
+        for (size_t i0 = 0; i0 < rows; i0 += CONVERT_CHUNK) {
+            size_t len = std::min(CONVERT_CHUNK, rows - i0);
+            utils::convert_n(w + p * ld + i0, len, buf);
+            for (size_t t = 0; t < S; ++t) {
+                const float xv = x[p * S + t];
+                float *y = tile + t * rows + i0;
+                for (size_t i = 0; i < len; ++i) {
+                    y[i] += buf[i] * xv;
+                }
+            }
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+inline __m256 load8(const float *p) {
+    return _mm256_loadu_ps(p);
+}
+
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+inline __m256 load8(const fp16_t *p) {
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+}
+
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+inline __m256 load8(const bf16_t *p) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+}
+
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+inline float reduceAdd8(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+// 同时计算 W 的 R 行与 X 的 S 列的点积，W 的每个向量与 S 个 X 向量相乘
+template <typename Tdata, size_t S, size_t R>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dotRowsAvx2(const Tdata *w, ptrdiff_t ld, size_t k, const float *x, float *tile, size_t ldt) {
+    __m256 acc[R][S];
+#pragma GCC unroll 8
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            acc[r][t] = _mm256_setzero_ps();
+        }
+    }
+    size_t p = 0;
+    for (; p + 8 <= k; p += 8) {
+        __m256 xv[S];
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            xv[t] = _mm256_loadu_ps(x + t * k + p);
+        }
+#pragma GCC unroll 8
+        for (size_t r = 0; r < R; ++r) {
+            __m256 wv = load8(w + r * ld + p);
+#pragma GCC unroll 8
+            for (size_t t = 0; t < S; ++t) {
+                acc[r][t] = _mm256_fmadd_ps(wv, xv[t], acc[r][t]);
+            }
+        }
+    }
+    for (size_t r = 0; r < R; ++r) {
+        for (size_t t = 0; t < S; ++t) {
+            float sum = reduceAdd8(acc[r][t]);
+            for (size_t q = p; q < k; ++q) {
+                sum += utils::cast<float>(w[r * ld + q]) * x[t * k + q];
+            }
+            tile[r + t * ldt] = sum;
+        }
+    }
+}
+
+// 将 W 的 P 行分别乘以 X 的对应值后累加到 tile，P 行同时连续读取，每个 tile 向量只读写一次
+template <typename Tdata, size_t S, size_t P>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void axpyRowsAvx2(const Tdata *w, ptrdiff_t ld, size_t rows, const float *x, float *tile) {
+    size_t i = 0;
+    for (; i + 8 <= rows; i += 8) {
+        __m256 wv[P];
+#pragma GCC unroll 8
+        for (size_t q = 0; q < P; ++q) {
+            wv[q] = load8(w + q * ld + i);
+        }
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            __m256 y = _mm256_loadu_ps(tile + t * rows + i);
+#pragma GCC unroll 8
+            for (size_t q = 0; q < P; ++q) {
+                y = _mm256_fmadd_ps(wv[q], _mm256_broadcast_ss(x + q * S + t), y);
+            }
+            _mm256_storeu_ps(tile + t * rows + i, y);
+        }
+    }
+    for (; i < rows; ++i) {
+        for (size_t q = 0; q < P; ++q) {
+            const float wv = utils::cast<float>(w[q * ld + i]);
+            for (size_t t = 0; t < S; ++t) {
+                tile[t * rows + i] += wv * x[q * S + t];
+            }
+        }
+    }
+}
+
+// AVX2 有 16 个向量寄存器，点积累加器不超过 8 个
+template <typename Tdata, size_t S>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dotBlockAvx2(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    constexpr size_t R = S <= 2 ? 4 : 8 / S;
+    size_t r = 0;
+    for (; r + R <= rows; r += R) {
+        dotRowsAvx2<Tdata, S, R>(w + r * ld, ld, k, x, tile + r, rows);
+    }
+    for (; r < rows; ++r) {
+        dotRowsAvx2<Tdata, S, 1>(w + r * ld, ld, k, x, tile + r, rows);
+    }
+}
+
+template <typename Tdata, size_t S>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void axpyBlockAvx2(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    std::fill(tile, tile + rows * S, 0.f);
+    size_t p = 0;
+    for (; p + AXPY_ROWS <= k; p += AXPY_ROWS) {
+        axpyRowsAvx2<Tdata, S, AXPY_ROWS>(w + p * ld, ld, rows, x + p * S, tile);
+    }
+    for (; p < k; ++p) {
+        axpyRowsAvx2<Tdata, S, 1>(w + p * ld, ld, rows, x + p * S, tile);
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+inline __m512 load16(const float *p, __mmask16 mask) {
+    return _mm512_maskz_loadu_ps(mask, p);
+}
+
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+inline __m512 load16(const fp16_t *p, __mmask16 mask) {
+    return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, p));
+}
+
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+inline __m512 load16(const bf16_t *p, __mmask16 mask) {
+    __m256i h = _mm256_maskz_loadu_epi16(mask, p);
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+}
+
+inline __mmask16 tailMask(size_t n) {
+    return n >= 16 ? __mmask16(0xffff) : __mmask16((1u << n) - 1);
+}
+
+// 与 dotRowsAvx2 相同，k 方向的尾部用掩码加载补零
+template <typename Tdata, size_t S, size_t R>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+void dotRowsAvx512(const Tdata *w, ptrdiff_t ld, size_t k, const float *x, float *tile, size_t ldt) {
+    __m512 acc[R][S];
+#pragma GCC unroll 8
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            acc[r][t] = _mm512_setzero_ps();
+        }
+    }
+    for (size_t p = 0; p < k; p += 16) {
+        const __mmask16 mask = tailMask(k - p);
+        __m512 xv[S];
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            xv[t] = _mm512_maskz_loadu_ps(mask, x + t * k + p);
+        }
+#pragma GCC unroll 8
+        for (size_t r = 0; r < R; ++r) {
+            __m512 wv = load16(w + r * ld + p, mask);
+#pragma GCC unroll 8
+            for (size_t t = 0; t < S; ++t) {
+                acc[r][t] = _mm512_fmadd_ps(wv, xv[t], acc[r][t]);
+            }
+        }
+    }
+    for (size_t r = 0; r < R; ++r) {
+        for (size_t t = 0; t < S; ++t) {
+            tile[r + t * ldt] = _mm512_reduce_add_ps(acc[r][t]);
+        }
+    }
+}
+
+// 与 axpyRowsAvx2 相同，行方向的尾部用掩码处理
+template <typename Tdata, size_t S, size_t P>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+void axpyRowsAvx512(const Tdata *w, ptrdiff_t ld, size_t rows, const float *x, float *tile) {
+    for (size_t i = 0; i < rows; i += 16) {
+        const __mmask16 mask = tailMask(rows - i);
+        __m512 wv[P];
+#pragma GCC unroll 8
+        for (size_t q = 0; q < P; ++q) {
+            wv[q] = load16(w + q * ld + i, mask);
+        }
+#pragma GCC unroll 8
+        for (size_t t = 0; t < S; ++t) {
+            __m512 y = _mm512_maskz_loadu_ps(mask, tile + t * rows + i);
+#pragma GCC unroll 8
+            for (size_t q = 0; q < P; ++q) {
+                y = _mm512_fmadd_ps(wv[q], _mm512_set1_ps(x[q * S + t]), y);
+            }
+            _mm512_mask_storeu_ps(tile + t * rows + i, mask, y);
+        }
+    }
+}
+
+// AVX-512 有 32 个向量寄存器，点积累加器不超过 16 个
+template <typename Tdata, size_t S>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+void dotBlockAvx512(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    constexpr size_t R = S <= 4 ? 4 : 2;
+    size_t r = 0;
+    for (; r + R <= rows; r += R) {
+        dotRowsAvx512<Tdata, S, R>(w + r * ld, ld, k, x, tile + r, rows);
+    }
+    for (; r < rows; ++r) {
+        dotRowsAvx512<Tdata, S, 1>(w + r * ld, ld, k, x, tile + r, rows);
+    }
+}
+
+template <typename Tdata, size_t S>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")
+void axpyBlockAvx512(const Tdata *w, ptrdiff_t ld, size_t rows, size_t k, const float *x, float *tile) {
+    std::fill(tile, tile + rows * S, 0.f);
+    size_t p = 0;
+    for (; p + AXPY_ROWS <= k; p += AXPY_ROWS) {
+        axpyRowsAvx512<Tdata, S, AXPY_ROWS>(w + p * ld, ld, rows, x + p * S, tile);
+    }
+    for (; p < k; ++p) {
+        axpyRowsAvx512<Tdata, S, 1>(w + p * ld, ld, rows, x + p * S, tile);
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+template <typename Tdata>
+const Kernels<Tdata> &kernels() {
+    static const Kernels<Tdata> table = [] {
+#ifdef INFINIOP_CPU_X86_SIMD
+        const auto &isa = device::cpu::isa();
+        if (isa.avx512 && isa.f16c) {
+            return Kernels<Tdata>{
+                {dotBlockAvx512<Tdata, 1>, dotBlockAvx512<Tdata, 2>, dotBlockAvx512<Tdata, 4>, dotBlockAvx512<Tdata, 8>},
+                {axpyBlockAvx512<Tdata, 1>, axpyBlockAvx512<Tdata, 2>, axpyBlockAvx512<Tdata, 4>, axpyBlockAvx512<Tdata, 8>}};
+        }
+        if (isa.avx2 && isa.f16c) {
+            return Kernels<Tdata>{
+                {dotBlockAvx2<Tdata, 1>, dotBlockAvx2<Tdata, 2>, dotBlockAvx2<Tdata, 4>, dotBlockAvx2<Tdata, 8>},
+                {axpyBlockAvx2<Tdata, 1>, axpyBlockAvx2<Tdata, 2>, axpyBlockAvx2<Tdata, 4>, axpyBlockAvx2<Tdata, 8>}};
+        }
+#endif
+        return Kernels<Tdata>{
+            {dotBlockGeneric<Tdata, 1>, dotBlockGeneric<Tdata, 2>, dotBlockGeneric<Tdata, 4>, dotBlockGeneric<Tdata, 8>},
+            {axpyBlockGeneric<Tdata, 1>, axpyBlockGeneric<Tdata, 2>, axpyBlockGeneric<Tdata, 4>, axpyBlockGeneric<Tdata, 8>}};
+    }();
+    return table;
+}
+
+// 将 X 转换为 fp32：dot 形式按 [S][k] 存放，axpy 形式按 [k][S] 存放，多余的列补零
+template <typename Tdata>
+void packX(const Tdata *x, ptrdiff_t ps, ptrdiff_t ts,
+           size_t k, size_t s, size_t cols, bool dot, float *dst) {
+    std::fill(dst, dst + k * cols, 0.f);
+    for (size_t t = 0; t < s; ++t) {
+        const Tdata *x_ = x + t * ts;
+        if (dot && ps == 1) {
+            utils::convert_n(x_, k, dst + t * k);
+        } else if (dot) {
+            for (size_t p = 0; p < k; ++p) {
+                dst[t * k + p] = utils::cast<float>(x_[p * ps]);
+            }
+        } else {
+            for (size_t p = 0; p < k; ++p) {
+                dst[p * cols + t] = utils::cast<float>(x_[p * ps]);
+            }
+        }
+    }
+}
+
+// 将 W 复制为与原布局方向相同的稠密矩阵：dot 形式按 [rows][k]，axpy 形式按 [k][rows]
+template <typename Tdata>
+void copyW(const Tdata *w, ptrdiff_t rs, ptrdiff_t cs,
+           size_t rows, size_t k, bool dot, Tdata *dst) {
+    if (dot) {
+        for (size_t r = 0; r < rows; ++r) {
+            std::copy(w + r * rs, w + r * rs + k, dst + r * k);
+        }
+    } else {
+        for (size_t p = 0; p < k; ++p) {
+            std::copy(w + p * cs, w + p * cs + rows, dst + p * rows);
+        }
+    }
+}
+
+// 用户的 B 是否为 W：n <= m 时 W 是内部的 A，而 is_transed 时内部的 A 是用户的 B
+bool bIsWeight(const MatmulInfo &info) {
+    return (info.n <= info.m) == info.is_transed;
+}
+
+// 操作数在批次间广播时只保存一份
+size_t batchCount(const MatmulInfo &info, ptrdiff_t batch_stride) {
+    return batch_stride == 0 ? 1 : info.batch;
+}
+
+int maxThreads() {
+#ifdef ENABLE_OMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/**
+ * 一次 GEMV 的 W 行块划分及计算各块所需的数据，X 已转换为 fp32。
+ * 块按批次、行块的顺序编号，不同块写入 Y 的不同区域，可以并行计算。
+ */
+template <typename Tdata>
+struct GemvTask {
+    Problem problem;
+    Epilogue epilogue;
+    BlockFn<Tdata> fn;
+    bool dot;
+    const float *x;
+    size_t x_bs;
+    size_t batch;
+    size_t block;
+
+    size_t blocks() const {
+        return batch * CEIL_DIV(problem.rows, block);
+    }
+};
+
+/**
+ * 准备一次 GEMV：X 未预打包时转换到 workspace 中，并按线程数切分 W 的行。
+ * 结果为空时返回 false。
+ */
+template <typename Tdata>
+bool makeTask(
+    GemvTask<Tdata> &task,
+    const MatmulInfo &info,
+    void *workspace,
+    void *c,
+    const void *a,
+    const void *b,
+    const void *packed_b,
+    const Epilogue &epilogue) {
+    if (info.is_transed) {
+        std::swap(a, b);
+    }
+    auto problem = makeProblem(info, c, a, b);
+    const size_t rows = problem.rows, k = problem.k, s = problem.s;
+    if (rows == 0 || s == 0 || info.batch == 0) {
+        return false;
+    }
+    const size_t cols = paddedCols(s);
+    const bool dot = problem.w_cs == 1;
+    const auto &table = kernels<Tdata>();
+
+    // 预打包的 W 是同方向的稠密矩阵，预打包的 X 已经是 fp32 布局
+    const bool packed_w = packed_b && bIsWeight(info);
+    const bool packed_x = packed_b && !bIsWeight(info);
+    if (packed_w) {
+        problem.w = packed_b;
+        problem.w_rs = dot ? ptrdiff_t(k) : 1;
+        problem.w_cs = dot ? 1 : ptrdiff_t(rows);
+        problem.w_bs = problem.w_bs == 0 ? 0 : ptrdiff_t(rows * k);
+    }
+    task.x = reinterpret_cast<const float *>(packed_x ? packed_b : workspace);
+    task.x_bs = k * cols;
+    if (packed_x) {
+        task.x_bs = problem.x_bs == 0 ? 0 : k * cols;
+    } else {
+        auto x = reinterpret_cast<const Tdata *>(problem.x);
+        auto dst = reinterpret_cast<float *>(workspace);
+        for (size_t i = 0; i < info.batch; ++i) {
+            packX(x + i * problem.x_bs, problem.x_ps, problem.x_ts, k, s, cols, dot, dst + i * k * cols);
+        }
+    }
+
+    task.problem = problem;
+    // m 较小时 Y = C^T，后处理的行列随之互换
+    task.epilogue = info.n <= info.m ? epilogue : epilogue.transposed();
+    task.fn = dot ? table.dot[colsIndex(cols)] : table.axpy[colsIndex(cols)];
+    task.dot = dot;
+    task.batch = info.batch;
+    // 按线程数切分 W 的行，块大小取 16 的倍数以对齐向量宽度
+    const size_t threads = size_t(maxThreads());
+    task.block = std::min(GEMV_BLOCK, std::max<size_t>(16, CEIL_DIV(CEIL_DIV(rows, threads), 16) * 16));
+    return true;
+}
+
+// 计算任务的第 t 个 W 行块并写回 Y
+template <typename Tdata>
+void computeBlock(const GemvTask<Tdata> &task, size_t t, float alpha, float beta) {
+    const auto &problem = task.problem;
+    const size_t blocks = CEIL_DIV(problem.rows, task.block);
+    const size_t batch = t / blocks;
+    const size_t i0 = t % blocks * task.block;
+    const size_t nb = std::min(task.block, problem.rows - i0);
+    auto w = reinterpret_cast<const Tdata *>(problem.w);
+    auto y = reinterpret_cast<Tdata *>(problem.y);
+    float tile[GEMV_BLOCK * GEMV_MAX_COLS];
+    task.fn(w + batch * problem.w_bs + i0 * problem.w_rs,
+            task.dot ? problem.w_rs : problem.w_cs,
+            nb, problem.k, task.x + batch * task.x_bs, tile);
+    const auto ep = task.epilogue.template at<Tdata>(batch, i0, 0);
+    writeBack(nb, problem.s, tile, ptrdiff_t(nb),
+              y + batch * problem.y_bs + i0 * problem.y_rs, problem.y_rs, problem.y_cs,
+              alpha, beta, &ep);
+}
+
+} // namespace
+
+bool gemvSupported(const MatmulInfo &info) {
+    // MatmulInfo 已保证每个矩阵在行或列方向上步长为 1，即 W 沿 k（点积核）或沿长边（axpy 核）连续，
+    // 小操作数与 C 的任意步长由打包和写回处理，这里只需限制短边
+    return std::min(info.m, info.n) <= GEMV_MAX_COLS;
+}
+
+size_t gemvWorkspaceSize(const MatmulInfo &info) {
+    return info.batch * info.k * paddedCols(std::min(info.m, info.n)) * sizeof(float);
+}
+
+size_t gemvPackedBSize(const MatmulInfo &info, size_t element_size) {
+    const auto problem = makeProblem(info, nullptr, nullptr, nullptr);
+    if (bIsWeight(info)) {
+        return batchCount(info, problem.w_bs) * problem.rows * problem.k * element_size;
+    }
+    return batchCount(info, problem.x_bs) * problem.k * paddedCols(problem.s) * sizeof(float);
+}
+
+template <typename Tdata>
+void gemvPrepackB(const MatmulInfo &info, void *packed_b, const void *b) {
+    // makeProblem 使用交换后的指针，因此把 B 放在 is_transed 交换后的位置上
+    const auto problem = info.is_transed
+                           ? makeProblem(info, nullptr, b, nullptr)
+                           : makeProblem(info, nullptr, nullptr, b);
+    const size_t rows = problem.rows, k = problem.k;
+    const bool dot = problem.w_cs == 1;
+    if (bIsWeight(info)) {
+        auto w = reinterpret_cast<const Tdata *>(problem.w);
+        auto dst = reinterpret_cast<Tdata *>(packed_b);
+        for (size_t i = 0; i < batchCount(info, problem.w_bs); ++i) {
+            copyW(w + i * problem.w_bs, problem.w_rs, problem.w_cs, rows, k, dot, dst + i * rows * k);
+        }
+    } else {
+        auto x = reinterpret_cast<const Tdata *>(problem.x);
+        auto dst = reinterpret_cast<float *>(packed_b);
+        const size_t cols = paddedCols(problem.s);
+        for (size_t i = 0; i < batchCount(info, problem.x_bs); ++i) {
+            packX(x + i * problem.x_bs, problem.x_ps, problem.x_ts, k, problem.s, cols, dot, dst + i * k * cols);
+        }
+    }
+}
+
+template <typename Tdata>
+void gemv(
+    const MatmulInfo &info,
+    void *workspace,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    float alpha,
+    const void *packed_b,
+    const Epilogue &epilogue) {
+    GemvTask<Tdata> task;
+    if (!makeTask(task, info, workspace, c, a, b, packed_b, epilogue)) {
+        return;
+    }
+    const ptrdiff_t tasks = ptrdiff_t(task.blocks());
+
+#pragma omp parallel for schedule(static)
+    for (ptrdiff_t t = 0; t < tasks; ++t) {
+        computeBlock(task, size_t(t), alpha, beta);
+    }
+}
+
+template <typename Tdata>
+GroupedWork gemvGroupedWork(
+    const MatmulInfo *infos,
+    size_t count,
+    void *workspace,
+    void *const *c,
+    float beta,
+    const void *const *a,
+    const void *const *b,
+    float alpha) {
+    std::vector<GemvTask<Tdata>> tasks;
+    // first[g] 是第 g 个任务的第一个块在全局块序号中的位置
+    std::vector<size_t> first(1, 0);
+    auto ws = reinterpret_cast<char *>(workspace);
+    for (size_t g = 0; g < count; ++g) {
+        GemvTask<Tdata> task;
+        if (makeTask(task, infos[g], ws, c[g], a[g], b[g], nullptr, Epilogue{})) {
+            tasks.push_back(task);
+            first.push_back(first.back() + task.blocks());
+        }
+        ws += gemvWorkspaceSize(infos[g]);
+    }
+    const size_t blocks = first.back();
+
+    return {blocks, [tasks = std::move(tasks), first = std::move(first), alpha, beta](size_t t) {
+                const size_t g = size_t(std::upper_bound(first.begin() + 1, first.end(), t) - first.begin() - 1);
+                computeBlock(tasks[g], t - first[g], alpha, beta);
+            }};
+}
+
+template void gemv<fp16_t>(const MatmulInfo &, void *, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+template void gemv<bf16_t>(const MatmulInfo &, void *, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+template void gemv<float>(const MatmulInfo &, void *, void *, float, const void *, const void *, float, const void *, const Epilogue &);
+
+template GroupedWork gemvGroupedWork<fp16_t>(const MatmulInfo *, size_t, void *, void *const *, float, const void *const *, const void *const *, float);
+template GroupedWork gemvGroupedWork<bf16_t>(const MatmulInfo *, size_t, void *, void *const *, float, const void *const *, const void *const *, float);
+template GroupedWork gemvGroupedWork<float>(const MatmulInfo *, size_t, void *, void *const *, float, const void *const *, const void *const *, float);
+
+template void gemvPrepackB<fp16_t>(const MatmulInfo &, void *, const void *);
+template void gemvPrepackB<bf16_t>(const MatmulInfo &, void *, const void *);
+template void gemvPrepackB<float>(const MatmulInfo &, void *, const void *);
+
+} // namespace op::gemm::cpu
@@ -0,0 +1,82 @@
+#ifndef __GEMV_CPU_H__
+#define __GEMV_CPU_H__
+
+#include "gemm_engine_cpu.h"
+
+namespace op::gemm::cpu {
+
+/**
+ * Largest `min(m, n)` handled by the GEMV path.
+ *
+ * Decode-time matmuls have a single activation row (`n == 1` once `MatmulInfo`
+ * has made C column-major, `m == 1` otherwise); small batches give 2-8 rows.
+ * For these shapes the packed engine is bound by packing the weight operand,
+ * while the GEMV path streams it exactly once.
+ */
+constexpr size_t GEMV_MAX_COLS = 8;
+
+/**
+ * Whether `gemv` supports `info`: one of m/n is at most `GEMV_MAX_COLS`. Any
+ * layout `MatmulInfo` accepts is handled, since it already makes the weight
+ * operand contiguous along k or along the long dimension.
+ */
+bool gemvSupported(const MatmulInfo &info);
+
+/**
+ * Workspace required by `gemv`, in bytes: the small operand converted to fp32.
+ */
+size_t gemvWorkspaceSize(const MatmulInfo &info);
+
+/**
+ * Compute `C = alpha * A * B + beta * C` for a shape accepted by `gemvSupported`.
+ *
+ * The long dimension of the weight operand is split across threads and every
+ * weight element is loaded once, widened to fp32 in registers.
+ *
+ * If `packed_b` is not null it holds B as written by `gemvPrepackB`, and `b`
+ * is ignored. `epilogue` is applied as in `gemm`.
+ */
+template <typename Tdata>
+void gemv(
+    const MatmulInfo &info,
+    void *workspace,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    float alpha,
+    const void *packed_b = nullptr,
+    const Epilogue &epilogue = {});
+
+/**
+ * Work of `gemv` for each group `g < count`, as `gemmGroupedWork` builds it for
+ * `gemm`. Every `infos[g]` must be accepted by `gemvSupported`, and `workspace`
+ * must hold the sum of their `gemvWorkspaceSize`. The small operands are packed
+ * into it while the work is built. One unit is one row block of one group.
+ */
+template <typename Tdata>
+GroupedWork gemvGroupedWork(
+    const MatmulInfo *infos,
+    size_t count,
+    void *workspace,
+    void *const *c,
+    float beta,
+    const void *const *a,
+    const void *const *b,
+    float alpha);
+
+/**
+ * Size in bytes of B prepacked for `gemv`.
+ *
+ * The weight is already streamed once, so when B is the weight it is only
+ * made dense in its own element type; when B is the small operand it is
+ * stored converted to fp32, as `gemv` would write it into the workspace.
+ */
+size_t gemvPackedBSize(const MatmulInfo &info, size_t element_size);
+
+template <typename Tdata>
+void gemvPrepackB(const MatmulInfo &info, void *packed_b, const void *b);
+
+} // namespace op::gemm::cpu
+
+#endif // __GEMV_CPU_H__
@@ -42,9 +42,12 @@
  * 这是一种安全的封装。
  *
  * 这个宏仅适用于矩阵乘，但这种模式很容易复制到其他算子，以简化和规范算子的声明。
+ *
+ * 宏的可选参数是特定硬件独有的公共接口声明，会原样插入到类定义的末尾，
+ * 例如 CPU 上预打包 B 的接口，其他硬件不必实现。
  */
 
-#define DESCRIPTOR(NAMESPACE)                                    \
+#define DESCRIPTOR(NAMESPACE, ...)                               \
                                                                  \
     namespace op::gemm::NAMESPACE {                              \
     class Descriptor final : public InfiniopDescriptor {         \
@@ -87,6 +90,8 @@
             const void *b,                                       \
             float alpha,                                         \
             void *stream) const;                                 \
+                                                                 \
+        __VA_ARGS__                                              \
     };                                                           \
     }
 
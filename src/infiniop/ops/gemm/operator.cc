@@ -171,6 +171,127 @@ __C infiniStatus_t infiniopGemm(
 #undef CALCULATE
 }
 
+// 预打包 B 目前只在 CPU 上实现
+__C infiniStatus_t
+infiniopGetGemmPackedBSize(
+    infiniopGemmDescriptor_t desc,
+    size_t *size) {
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        *size = reinterpret_cast<const op::gemm::cpu::Descriptor *>(desc)->packedBSize();
+        return INFINI_STATUS_SUCCESS;
+#endif
+
+    default:
+        return INFINI_STATUS_NOT_IMPLEMENTED;
+    }
+}
+
+__C infiniStatus_t infiniopGemmPrepackB(
+    infiniopGemmDescriptor_t desc,
+    void *packed_b,
+    const void *b,
+    void *stream) {
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return reinterpret_cast<const op::gemm::cpu::Descriptor *>(desc)
+            ->prepackB(packed_b, b);
+#endif
+
+    default:
+        return INFINI_STATUS_NOT_IMPLEMENTED;
+    }
+}
+
+__C infiniStatus_t infiniopGemmPrepacked(
+    infiniopGemmDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *packed_b,
+    float alpha,
+    float beta,
+    void *stream) {
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return reinterpret_cast<const op::gemm::cpu::Descriptor *>(desc)
+            ->calculatePrepacked(workspace, workspace_size,
+                                 c, beta,
+                                 a, packed_b, alpha);
+#endif
+
+    default:
+        return INFINI_STATUS_NOT_IMPLEMENTED;
+    }
+}
+
+// 带后处理的矩阵乘目前只在 CPU 上实现
+__C infiniStatus_t infiniopCreateGemmEpilogueDescriptor(
+    infiniopHandle_t handle,
+    infiniopGemmDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t b_desc,
+    infiniopTensorDescriptor_t bias_desc,
+    infiniopTensorDescriptor_t residual_desc,
+    infiniopActivation_t activation) {
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return op::gemm::cpu::Descriptor::createEpilogue(
+            handle,
+            reinterpret_cast<op::gemm::cpu::Descriptor **>(desc_ptr),
+            c_desc,
+            a_desc,
+            b_desc,
+            bias_desc,
+            residual_desc,
+            activation);
+#endif
+
+    default:
+        return INFINI_STATUS_NOT_IMPLEMENTED;
+    }
+}
+
+__C infiniStatus_t infiniopGemmEpilogue(
+    infiniopGemmDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *b,
+    const void *bias,
+    const void *residual,
+    float alpha,
+    float beta,
+    void *stream) {
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return reinterpret_cast<const op::gemm::cpu::Descriptor *>(desc)
+            ->calculateEpilogue(workspace, workspace_size,
+                                c, beta,
+                                a, b, bias, residual, alpha);
+#endif
+
+    default:
+        return INFINI_STATUS_NOT_IMPLEMENTED;
+    }
+}
+
 __C infiniStatus_t
 infiniopDestroyGemmDescriptor(infiniopGemmDescriptor_t desc) {
 
@@ -0,0 +1,399 @@
+#include "gguf_gemm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include <algorithm>
+#include <cmath>
+
+namespace op::gguf_gemm::cpu {
+
+namespace {
+
+// 每次内核调用计算的 A 行数上限，同一权重块解包后供这些行共用
+constexpr size_t MAX_ROWS = 4;
+
+// 每个任务负责 TASK_ROWS 行 A 与 TASK_COLS 行权重，权重行留在 L1 中
+constexpr size_t TASK_ROWS = 16;
+constexpr size_t TASK_COLS = 16;
+
+// 量化后的激活：每 32 个元素一块，x ≈ d * q，sum 为 q 之和，用于减去权重的零点
+constexpr size_t QK8 = 32;
+
+struct BlockQ8 {
+    float d;
+    int32_t sum;
+    int8_t qs[QK8];
+};
+
+/**
+ * 计算 rows 行激活与一行权重的点积：out[r] = sum_p(a[r][p] * w[p])。
+ *
+ * - w 为一行权重的 nb 个块；
+ * - a 为第一行激活的量化块，相邻两行相距 lda 块。
+ */
+using DotFn = void (*)(const void *w, const BlockQ8 *a, size_t lda, size_t nb, float *out);
+
+struct Kernels {
+    // fn[r - 1] 计算 r 行
+    DotFn fn[MAX_ROWS];
+};
+
+// Q4_K 子块 j 的 6 位缩放系数与最小值，与 ggml 的 get_scale_min_k4 相同
+inline void scaleMinK4(size_t j, const uint8_t *q, uint8_t &sc, uint8_t &mn) {
+    if (j < 4) {
+        sc = q[j] & 63;
+        mn = q[j + 4] & 63;
+    } else {
+        sc = (q[j + 4] & 0xF) | ((q[j - 4] >> 6) << 4);
+        mn = (q[j + 4] >> 4) | ((q[j] >> 6) << 4);
+    }
+}
+
+// 4 位权重 q 与激活块的整数点积
+inline int32_t dotNibbles(const uint8_t *q, const int8_t *a) {
+    int32_t sum = 0;
+    for (size_t i = 0; i < QK8; ++i) {
+        sum += int32_t(q[i]) * int32_t(a[i]);
+    }
+    return sum;
+}
+
+template <size_t R>
+void dotQ4_0Generic(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ4_0 *>(w_);
+    float sum[R] = {};
+    uint8_t q[QK4_0];
+    for (size_t b = 0; b < nb; ++b) {
+        for (size_t i = 0; i < QK4_0 / 2; ++i) {
+            q[i] = w[b].qs[i] & 0xF;
+            q[i + QK4_0 / 2] = w[b].qs[i] >> 4;
+        }
+        const float d = utils::cast<float>(w[b].d);
+        for (size_t r = 0; r < R; ++r) {
+            const BlockQ8 &ab = a[r * lda + b];
+            sum[r] += d * ab.d * float(dotNibbles(q, ab.qs) - 8 * ab.sum);
+        }
+    }
+    std::copy(sum, sum + R, out);
+}
+
+template <size_t R>
+void dotQ8_0Generic(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ8_0 *>(w_);
+    float sum[R] = {};
+    for (size_t b = 0; b < nb; ++b) {
+        const float d = utils::cast<float>(w[b].d);
+        for (size_t r = 0; r < R; ++r) {
+            const BlockQ8 &ab = a[r * lda + b];
+            int32_t dot = 0;
+            for (size_t i = 0; i < QK8_0; ++i) {
+                dot += int32_t(w[b].qs[i]) * int32_t(ab.qs[i]);
+            }
+            sum[r] += d * ab.d * float(dot);
+        }
+    }
+    std::copy(sum, sum + R, out);
+}
+
+template <size_t R>
+void dotQ4_KGeneric(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ4_K *>(w_);
+    constexpr size_t SUB = QK_K / QK8;
+    float sum[R] = {};
+    uint8_t q[QK8];
+    for (size_t b = 0; b < nb; ++b) {
+        const float d = utils::cast<float>(w[b].d);
+        const float dmin = utils::cast<float>(w[b].dmin);
+        for (size_t j = 0; j < SUB; ++j) {
+            uint8_t sc, mn;
+            scaleMinK4(j, w[b].scales, sc, mn);
+            const uint8_t *qs = w[b].qs + j / 2 * QK8;
+            for (size_t i = 0; i < QK8; ++i) {
+                q[i] = j % 2 == 0 ? qs[i] & 0xF : qs[i] >> 4;
+            }
+            for (size_t r = 0; r < R; ++r) {
+                const BlockQ8 &ab = a[r * lda + b * SUB + j];
+                sum[r] += ab.d * (d * sc * float(dotNibbles(q, ab.qs)) - dmin * mn * float(ab.sum));
+            }
+        }
+    }
+    std::copy(sum, sum + R, out);
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// 以下内核中行的循环须完全展开，累加器才能留在寄存器中
+
+INFINIOP_CPU_TARGET("avx2,fma")
+inline float hsum(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+// u8 x s8 的 32 对乘积按 4 个一组求和，vpmaddubsw 的 int16 中间结果在此处不会饱和
+INFINIOP_CPU_TARGET("avx2,fma")
+inline __m256 dotU8S8(__m256i u, __m256i s) {
+    const __m256i p = _mm256_madd_epi16(_mm256_maddubs_epi16(u, s), _mm256_set1_epi16(1));
+    return _mm256_cvtepi32_ps(p);
+}
+
+INFINIOP_CPU_TARGET("avx2,fma")
+inline __m256i loadQ8(const BlockQ8 &b) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b.qs));
+}
+
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dotQ4_0Avx2(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ4_0 *>(w_);
+    const __m256i nibble = _mm256_set1_epi8(0xF);
+    __m256 acc[R];
+    float corr[R];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        acc[r] = _mm256_setzero_ps();
+        corr[r] = 0.f;
+    }
+    for (size_t b = 0; b < nb; ++b) {
+        const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i *>(w[b].qs));
+        const __m256i q = _mm256_and_si256(_mm256_set_m128i(_mm_srli_epi16(raw, 4), raw), nibble);
+        const float d = _cvtsh_ss(w[b].d._v);
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            const BlockQ8 &ab = a[r * lda + b];
+            const float dd = d * ab.d;
+            acc[r] = _mm256_fmadd_ps(dotU8S8(q, loadQ8(ab)), _mm256_set1_ps(dd), acc[r]);
+            // 权重存储为 q + 8
+            corr[r] += dd * float(8 * ab.sum);
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        out[r] = hsum(acc[r]) - corr[r];
+    }
+}
+
+// s8 x s8 借助 vpsignb 转成 |w| x (a * sign(w))
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dotQ8_0Avx2(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ8_0 *>(w_);
+    __m256 acc[R];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        acc[r] = _mm256_setzero_ps();
+    }
+    for (size_t b = 0; b < nb; ++b) {
+        const __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w[b].qs));
+        const __m256i abs_q = _mm256_sign_epi8(q, q);
+        const float d = _cvtsh_ss(w[b].d._v);
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            const BlockQ8 &ab = a[r * lda + b];
+            const __m256i s = _mm256_sign_epi8(loadQ8(ab), q);
+            acc[r] = _mm256_fmadd_ps(dotU8S8(abs_q, s), _mm256_set1_ps(d * ab.d), acc[r]);
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        out[r] = hsum(acc[r]);
+    }
+}
+
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma,f16c")
+void dotQ4_KAvx2(const void *w_, const BlockQ8 *a, size_t lda, size_t nb, float *out) {
+    auto w = reinterpret_cast<const BlockQ4_K *>(w_);
+    constexpr size_t SUB = QK_K / QK8;
+    const __m256i nibble = _mm256_set1_epi8(0xF);
+    __m256 acc[R];
+    float corr[R];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        acc[r] = _mm256_setzero_ps();
+        corr[r] = 0.f;
+    }
+    for (size_t b = 0; b < nb; ++b) {
+        const float d = _cvtsh_ss(w[b].d._v);
+        const float dmin = _cvtsh_ss(w[b].dmin._v);
+        float sc[SUB], mn[SUB];
+        for (size_t j = 0; j < SUB; ++j) {
+            uint8_t sc_, mn_;
+            scaleMinK4(j, w[b].scales, sc_, mn_);
+            sc[j] = d * sc_;
+            mn[j] = dmin * mn_;
+        }
+        // 每 32 字节的低 4 位属于子块 2j，高 4 位属于子块 2j + 1
+        for (size_t j = 0; j < SUB; j += 2) {
+            const __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w[b].qs + j / 2 * QK8));
+            const __m256i lo = _mm256_and_si256(raw, nibble);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(raw, 4), nibble);
+#pragma GCC unroll 4
+            for (size_t r = 0; r < R; ++r) {
+                const BlockQ8 *ab = a + r * lda + b * SUB + j;
+                acc[r] = _mm256_fmadd_ps(dotU8S8(lo, loadQ8(ab[0])), _mm256_set1_ps(sc[j] * ab[0].d), acc[r]);
+                acc[r] = _mm256_fmadd_ps(dotU8S8(hi, loadQ8(ab[1])), _mm256_set1_ps(sc[j + 1] * ab[1].d), acc[r]);
+                corr[r] += mn[j] * ab[0].d * float(ab[0].sum) + mn[j + 1] * ab[1].d * float(ab[1].sum);
+            }
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+        out[r] = hsum(acc[r]) - corr[r];
+    }
+}
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+#define KERNELS(NAME) \
+    Kernels { { NAME<1>, NAME<2>, NAME<3>, NAME<4> } }
+
+Kernels kernels(infiniopGGUFType_t type) {
+#ifdef INFINIOP_CPU_X86_SIMD
+    const auto &isa = device::cpu::isa();
+    if (isa.avx2 && isa.f16c) {
+        switch (type) {
+        case INFINIOP_GGUF_TYPE_Q4_0:
+            return KERNELS(dotQ4_0Avx2);
+        case INFINIOP_GGUF_TYPE_Q8_0:
+            return KERNELS(dotQ8_0Avx2);
+        default:
+            return KERNELS(dotQ4_KAvx2);
+        }
+    }
+#endif
+    switch (type) {
+    case INFINIOP_GGUF_TYPE_Q4_0:
+        return KERNELS(dotQ4_0Generic);
+    case INFINIOP_GGUF_TYPE_Q8_0:
+        return KERNELS(dotQ8_0Generic);
+    default:
+        return KERNELS(dotQ4_KGeneric);
+    }
+}
+
+#undef KERNELS
+
+// 与 ggml 的 quantize_row_q8_0 相同：d = max|x| / 127，q = roundf(x / d)，正好居中的值远离零舍入
+template <typename Tdata>
+void quantizeRow(const Tdata *x, ptrdiff_t stride, size_t k, BlockQ8 *y) {
+    for (size_t b = 0; b < k / QK8; ++b) {
+        float v[QK8];
+        float amax = 0.f;
+        for (size_t i = 0; i < QK8; ++i) {
+            v[i] = utils::cast<float>(x[ptrdiff_t(b * QK8 + i) * stride]);
+            amax = std::max(amax, std::fabs(v[i]));
+        }
+        const float d = amax / 127.f;
+        const float id = d != 0.f ? 1.f / d : 0.f;
+        int32_t sum = 0;
+        for (size_t i = 0; i < QK8; ++i) {
+            y[b].qs[i] = int8_t(std::round(v[i] * id));
+            sum += y[b].qs[i];
+        }
+        y[b].d = d;
+        y[b].sum = sum;
+    }
+}
+
+size_t quantizedSize(const GGUFGemmInfo &info) {
+    return info.m * (info.k / QK8) * sizeof(BlockQ8);
+}
+
+template <typename Tdata>
+void ggufGemm(const GGUFGemmInfo &info, void *workspace, Tdata *c, const Tdata *a, const uint8_t *w) {
+    const size_t m = info.m, n = info.n;
+    const size_t lda = info.k / QK8, nb = info.k / blockSize(info.w_type);
+    if (m == 0 || n == 0) {
+        return;
+    }
+
+    auto a_q = reinterpret_cast<BlockQ8 *>(workspace);
+#pragma omp parallel for
+    for (ptrdiff_t i = 0; i < ptrdiff_t(m); ++i) {
+        quantizeRow(a + i * info.a_row_stride, info.a_col_stride, info.k, a_q + i * lda);
+    }
+
+    const auto table = kernels(info.w_type);
+    const size_t tiles_m = CEIL_DIV(m, TASK_ROWS);
+    const size_t tiles_n = CEIL_DIV(n, TASK_COLS);
+    const ptrdiff_t tasks = ptrdiff_t(tiles_m * tiles_n);
+
+#pragma omp parallel for schedule(static)
+    for (ptrdiff_t t = 0; t < tasks; ++t) {
+        const size_t j0 = size_t(t) % tiles_n * TASK_COLS;
+        const size_t i0 = size_t(t) / tiles_n * TASK_ROWS;
+        const size_t nb_cols = std::min(TASK_COLS, n - j0);
+        const size_t mb = std::min(TASK_ROWS, m - i0);
+
+        float out[MAX_ROWS];
+        for (size_t j = j0; j < j0 + nb_cols; ++j) {
+            const uint8_t *w_row = w + ptrdiff_t(j) * info.w_row_stride;
+            for (size_t i = i0; i < i0 + mb; i += MAX_ROWS) {
+                const size_t rows = std::min(MAX_ROWS, i0 + mb - i);
+                table.fn[rows - 1](w_row, a_q + i * lda, lda, nb, out);
+                for (size_t r = 0; r < rows; ++r) {
+                    c[ptrdiff_t(i + r) * info.c_row_stride + ptrdiff_t(j) * info.c_col_stride] = utils::cast<Tdata>(out[r]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+struct Descriptor::Opaque {};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t w_desc,
+    infiniopGGUFType_t w_type) {
+    auto result = GGUFGemmInfo::create(c_desc, a_desc, w_desc, w_type);
+    CHECK_RESULT(result);
+    auto info = result.take();
+    size_t workspace_size = quantizedSize(info);
+    *desc_ptr = new Descriptor(nullptr, info, workspace_size, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *w,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    auto w_ = reinterpret_cast<const uint8_t *>(w);
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        ggufGemm(_info, workspace, reinterpret_cast<fp16_t *>(c), reinterpret_cast<const fp16_t *>(a), w_);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_BF16:
+        ggufGemm(_info, workspace, reinterpret_cast<bf16_t *>(c), reinterpret_cast<const bf16_t *>(a), w_);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_F32:
+        ggufGemm(_info, workspace, reinterpret_cast<float *>(c), reinterpret_cast<const float *>(a), w_);
+        return INFINI_STATUS_SUCCESS;
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::gguf_gemm::cpu
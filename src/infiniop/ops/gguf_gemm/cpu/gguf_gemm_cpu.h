@@ -0,0 +1,8 @@
+#ifndef __GGUF_GEMM_CPU_H__
+#define __GGUF_GEMM_CPU_H__
+
+#include "../gguf_gemm.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __GGUF_GEMM_CPU_H__
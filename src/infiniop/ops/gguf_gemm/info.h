@@ -0,0 +1,119 @@
+#ifndef __GGUF_GEMM_INFO_H__
+#define __GGUF_GEMM_INFO_H__
+
+#include "../../../utils.h"
+#include "../../tensor.h"
+#include "infiniop/ops/gguf_gemm.h"
+
+namespace op::gguf_gemm {
+
+// 与 ggml 相同的块格式
+constexpr size_t QK4_0 = 32;
+constexpr size_t QK8_0 = 32;
+constexpr size_t QK_K = 256;
+constexpr size_t K_SCALE_SIZE = 12;
+
+// x = d * (q - 8)，第 i 个值在 qs[i] 的低 4 位，第 i + 16 个在高 4 位
+struct BlockQ4_0 {
+    fp16_t d;
+    uint8_t qs[QK4_0 / 2];
+};
+static_assert(sizeof(BlockQ4_0) == 2 + QK4_0 / 2, "wrong q4_0 block size");
+
+// x = d * q
+struct BlockQ8_0 {
+    fp16_t d;
+    int8_t qs[QK8_0];
+};
+static_assert(sizeof(BlockQ8_0) == 2 + QK8_0, "wrong q8_0 block size");
+
+/**
+ * 8 个 32 元素的子块，x = d * sc * q - dmin * m，
+ * sc 与 m 为 6 位，压缩存放在 scales 中；每 32 字节 qs 的低 4 位属于一个子块、高 4 位属于下一个子块。
+ */
+struct BlockQ4_K {
+    fp16_t d;
+    fp16_t dmin;
+    uint8_t scales[K_SCALE_SIZE];
+    uint8_t qs[QK_K / 2];
+};
+static_assert(sizeof(BlockQ4_K) == 4 + K_SCALE_SIZE + QK_K / 2, "wrong q4_K block size");
+
+// 每种格式一个块包含的元素数与字节数
+inline size_t blockSize(infiniopGGUFType_t type) {
+    return type == INFINIOP_GGUF_TYPE_Q4_K ? QK_K : QK4_0;
+}
+
+inline size_t blockBytes(infiniopGGUFType_t type) {
+    switch (type) {
+    case INFINIOP_GGUF_TYPE_Q4_0:
+        return sizeof(BlockQ4_0);
+    case INFINIOP_GGUF_TYPE_Q8_0:
+        return sizeof(BlockQ8_0);
+    case INFINIOP_GGUF_TYPE_Q4_K:
+        return sizeof(BlockQ4_K);
+    default:
+        return 0;
+    }
+}
+
+class GGUFGemmInfo {
+    GGUFGemmInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+    infiniopGGUFType_t w_type;
+    size_t m, n, k;
+    ptrdiff_t a_row_stride, a_col_stride;
+    ptrdiff_t c_row_stride, c_col_stride;
+    // 权重相邻两行的字节距离
+    ptrdiff_t w_row_stride;
+
+    static utils::Result<GGUFGemmInfo> create(
+        infiniopTensorDescriptor_t c_desc,
+        infiniopTensorDescriptor_t a_desc,
+        infiniopTensorDescriptor_t w_desc,
+        infiniopGGUFType_t w_type) {
+
+        auto dtype = c_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_DTYPE(w_desc->dtype(), INFINI_DTYPE_U8, INFINI_DTYPE_BYTE);
+        if (a_desc->dtype() != dtype) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        if (blockBytes(w_type) == 0) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+
+        if (c_desc->ndim() != 2 || a_desc->ndim() != 2 || w_desc->ndim() != 2) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        size_t m = c_desc->dim(0), n = c_desc->dim(1), k = a_desc->dim(1);
+        if (k % blockSize(w_type) != 0) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        if (a_desc->dim(0) != m || w_desc->dim(0) != n
+            || w_desc->dim(1) != k / blockSize(w_type) * blockBytes(w_type)) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        if (w_desc->stride(1) != 1) {
+            return INFINI_STATUS_BAD_TENSOR_STRIDES;
+        }
+
+        return utils::Result<GGUFGemmInfo>(GGUFGemmInfo{
+            dtype,
+            w_type,
+            m,
+            n,
+            k,
+            a_desc->stride(0),
+            a_desc->stride(1),
+            c_desc->stride(0),
+            c_desc->stride(1),
+            w_desc->stride(0)});
+    }
+};
+
+} // namespace op::gguf_gemm
+
+#endif // __GGUF_GEMM_INFO_H__
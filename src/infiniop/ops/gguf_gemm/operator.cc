@@ -0,0 +1,109 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "infiniop/ops/gguf_gemm.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/gguf_gemm_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateGGUFGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopGGUFGemmDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t w_desc,
+    infiniopGGUFType_t w_type) {
+
+#define CREATE(CASE, NAMESPACE)                                                  \
+    case CASE:                                                                   \
+        return op::gguf_gemm::NAMESPACE::Descriptor::create(                     \
+            handle,                                                              \
+            reinterpret_cast<op::gguf_gemm::NAMESPACE::Descriptor **>(desc_ptr), \
+            c_desc,                                                              \
+            a_desc,                                                              \
+            w_desc,                                                              \
+            w_type)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetGGUFGemmWorkspaceSize(
+    infiniopGGUFGemmDescriptor_t desc,
+    size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                           \
+    case CASE:                                                                                         \
+        *size = reinterpret_cast<const op::gguf_gemm::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopGGUFGemm(
+    infiniopGGUFGemmDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *w,
+    void *stream) {
+
+#define CALCULATE(CASE, NAMESPACE)                                                  \
+    case CASE:                                                                      \
+        return reinterpret_cast<const op::gguf_gemm::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                  \
+                        c, a, w,                                                    \
+                        stream)
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t
+infiniopDestroyGGUFGemmDescriptor(infiniopGGUFGemmDescriptor_t desc) {
+
+#define DELETE(CASE, NAMESPACE)                                                      \
+    case CASE:                                                                       \
+        delete reinterpret_cast<const op::gguf_gemm::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
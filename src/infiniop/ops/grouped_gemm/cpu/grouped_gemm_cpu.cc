@@ -0,0 +1,131 @@
+#include "grouped_gemm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../gemm/cpu/gemm_engine_cpu.h"
+#include "../../gemm/cpu/gemm_tune_cpu.h"
+#include "../../gemm/cpu/gemv_cpu.h"
+
+namespace op::grouped_gemm::cpu {
+
+/**
+ * 每组与同形状的 Gemm 一样经 tunedConfig 选择 GEMV 路径或分块引擎及其分块大小，
+ * 调优缓存中的结果同样生效；两类组的所有工作单元在同一个并行区域内计算，而不是逐组调用。
+ */
+struct Descriptor::Opaque {
+    // 两条路径的组及其在用户数组中的序号，gemm_configs 与 gemm_infos 一一对应
+    std::vector<gemm::MatmulInfo> gemv_infos, gemm_infos;
+    std::vector<gemm::cpu::BlockConfig> gemm_configs;
+    std::vector<size_t> gemv_index, gemm_index;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    size_t group_count,
+    const infiniopTensorDescriptor_t *c_descs,
+    const infiniopTensorDescriptor_t *a_descs,
+    const infiniopTensorDescriptor_t *b_descs) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = GroupedGemmInfo::create(group_count, c_descs, a_descs, b_descs, gemm::MatrixLayout::COL_MAJOR);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    auto opaque = new Opaque{};
+    size_t workspace_size = 0;
+    for (size_t g = 0; g < info.groups.size(); ++g) {
+        const auto &group = info.groups[g];
+        const auto tuned = gemm::cpu::tunedConfig(info.dtype, group);
+        if (tuned.gemv) {
+            opaque->gemv_infos.push_back(group);
+            opaque->gemv_index.push_back(g);
+            workspace_size += gemm::cpu::gemvWorkspaceSize(group);
+        } else {
+            opaque->gemm_infos.push_back(group);
+            opaque->gemm_configs.push_back(tuned.config);
+            opaque->gemm_index.push_back(g);
+        }
+    }
+
+    *desc_ptr = new Descriptor(opaque, std::move(info), workspace_size, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <typename Tdata, typename Opaque>
+void compute(
+    const Opaque &opaque,
+    void *workspace,
+    void *const *c,
+    float beta,
+    const void *const *a,
+    const void *const *b,
+    float alpha) {
+    // 按路径重排用户的指针数组
+    auto gather = [&](const std::vector<size_t> &index, std::vector<void *> &c_, std::vector<const void *> &a_, std::vector<const void *> &b_) {
+        for (size_t g : index) {
+            c_.push_back(c[g]);
+            a_.push_back(a[g]);
+            b_.push_back(b[g]);
+        }
+    };
+    std::vector<void *> c_gemv, c_gemm;
+    std::vector<const void *> a_gemv, b_gemv, a_gemm, b_gemm;
+    gather(opaque.gemv_index, c_gemv, a_gemv, b_gemv);
+    gather(opaque.gemm_index, c_gemm, a_gemm, b_gemm);
+
+    const auto gemv_work = gemm::cpu::gemvGroupedWork<Tdata>(opaque.gemv_infos.data(), opaque.gemv_infos.size(), workspace, c_gemv.data(), beta, a_gemv.data(), b_gemv.data(), alpha);
+    const auto gemm_work = gemm::cpu::gemmGroupedWork<Tdata>(opaque.gemm_infos.data(), opaque.gemm_infos.size(), opaque.gemm_configs.data(), c_gemm.data(), beta, a_gemm.data(), b_gemm.data(), alpha);
+
+    // 各组互不依赖，先做完 GEMV 块的线程不等待，直接领取 GEMM 的分块
+#pragma omp parallel
+    {
+#pragma omp for schedule(dynamic) nowait
+        for (ptrdiff_t t = 0; t < ptrdiff_t(gemv_work.units); ++t) {
+            gemv_work.run(size_t(t));
+        }
+#pragma omp for schedule(dynamic)
+        for (ptrdiff_t t = 0; t < ptrdiff_t(gemm_work.units); ++t) {
+            gemm_work.run(size_t(t));
+        }
+    }
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *const *c,
+    const void *const *a,
+    const void *const *b,
+    float alpha,
+    float beta,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    if (!c || !a || !b) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        compute<fp16_t>(*_opaque, workspace, c, beta, a, b, alpha);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_BF16:
+        compute<bf16_t>(*_opaque, workspace, c, beta, a, b, alpha);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_F32:
+        compute<float>(*_opaque, workspace, c, beta, a, b, alpha);
+        return INFINI_STATUS_SUCCESS;
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::grouped_gemm::cpu
@@ -0,0 +1,8 @@
+#ifndef __GROUPED_GEMM_CPU_H__
+#define __GROUPED_GEMM_CPU_H__
+
+#include "../grouped_gemm.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __GROUPED_GEMM_CPU_H__
@@ -0,0 +1,51 @@
+#ifndef __GROUPED_GEMM_H__
+#define __GROUPED_GEMM_H__
+
+#include "../../operator.h"
+#include "info.h"
+
+#define DESCRIPTOR(NAMESPACE)                                    \
+                                                                 \
+    namespace op::grouped_gemm::NAMESPACE {                      \
+    class Descriptor final : public InfiniopDescriptor {         \
+        struct Opaque;                                           \
+        Opaque *_opaque;                                         \
+        GroupedGemmInfo _info;                                   \
+        size_t _workspace_size;                                  \
+                                                                 \
+        Descriptor(                                              \
+            Opaque *opaque,                                      \
+            GroupedGemmInfo info,                                \
+            size_t workspace_size,                               \
+            infiniDevice_t device_type,                          \
+            int device_id)                                       \
+            : InfiniopDescriptor{device_type, device_id},        \
+              _opaque(opaque),                                   \
+              _info(std::move(info)),                            \
+              _workspace_size(workspace_size) {}                 \
+                                                                 \
+    public:                                                      \
+        ~Descriptor();                                           \
+                                                                 \
+        size_t workspaceSize() const { return _workspace_size; } \
+                                                                 \
+        static infiniStatus_t create(                            \
+            infiniopHandle_t handle,                             \
+            Descriptor **desc_ptr,                               \
+            size_t group_count,                                  \
+            const infiniopTensorDescriptor_t *c_descs,           \
+            const infiniopTensorDescriptor_t *a_descs,           \
+            const infiniopTensorDescriptor_t *b_descs);          \
+                                                                 \
+        infiniStatus_t calculate(                                \
+            void *workspace, size_t workspace_size,              \
+            void *const *c,                                      \
+            const void *const *a,                                \
+            const void *const *b,                                \
+            float alpha,                                         \
+            float beta,                                          \
+            void *stream) const;                                 \
+    };                                                           \
+    }
+
+#endif // __GROUPED_GEMM_H__
@@ -0,0 +1,55 @@
+#ifndef __GROUPED_GEMM_INFO_H__
+#define __GROUPED_GEMM_INFO_H__
+
+#include "../gemm/info.h"
+#include <vector>
+
+namespace op::grouped_gemm {
+
+class GroupedGemmInfo {
+    GroupedGemmInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+    // 每组一个矩阵乘，规则与 Gemm 相同
+    std::vector<gemm::MatmulInfo> groups;
+
+    static utils::Result<GroupedGemmInfo> create(
+        size_t group_count,
+        const infiniopTensorDescriptor_t *c_descs,
+        const infiniopTensorDescriptor_t *a_descs,
+        const infiniopTensorDescriptor_t *b_descs,
+        gemm::MatrixLayout layout) {
+
+        if (group_count == 0 || !c_descs || !a_descs || !b_descs) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+
+        for (size_t g = 0; g < group_count; ++g) {
+            if (!c_descs[g] || !a_descs[g] || !b_descs[g]) {
+                return INFINI_STATUS_NULL_POINTER;
+            }
+        }
+
+        GroupedGemmInfo info;
+        info.dtype = c_descs[0]->dtype();
+        CHECK_DTYPE(info.dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        info.groups.reserve(group_count);
+        for (size_t g = 0; g < group_count; ++g) {
+            if (c_descs[g]->dtype() != info.dtype
+                || a_descs[g]->dtype() != info.dtype
+                || b_descs[g]->dtype() != info.dtype) {
+                return INFINI_STATUS_BAD_TENSOR_DTYPE;
+            }
+            auto result = gemm::MatmulInfo::create(c_descs[g], a_descs[g], b_descs[g], layout);
+            CHECK_RESULT(result);
+            info.groups.push_back(result.take());
+        }
+
+        return utils::Result<GroupedGemmInfo>(std::move(info));
+    }
+};
+
+} // namespace op::grouped_gemm
+
+#endif // __GROUPED_GEMM_INFO_H__
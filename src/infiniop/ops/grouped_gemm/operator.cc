@@ -0,0 +1,112 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "infiniop/ops/grouped_gemm.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/grouped_gemm_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateGroupedGemmDescriptor(
+    infiniopHandle_t handle,
+    infiniopGroupedGemmDescriptor_t *desc_ptr,
+    size_t group_count,
+    const infiniopTensorDescriptor_t *c_descs,
+    const infiniopTensorDescriptor_t *a_descs,
+    const infiniopTensorDescriptor_t *b_descs) {
+
+#define CREATE(CASE, NAMESPACE)                                                     \
+    case CASE:                                                                      \
+        return op::grouped_gemm::NAMESPACE::Descriptor::create(                     \
+            handle,                                                                 \
+            reinterpret_cast<op::grouped_gemm::NAMESPACE::Descriptor **>(desc_ptr), \
+            group_count,                                                            \
+            c_descs,                                                                \
+            a_descs,                                                                \
+            b_descs)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetGroupedGemmWorkspaceSize(
+    infiniopGroupedGemmDescriptor_t desc,
+    size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                              \
+    case CASE:                                                                                            \
+        *size = reinterpret_cast<const op::grouped_gemm::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopGroupedGemm(
+    infiniopGroupedGemmDescriptor_t desc,
+    void *workspace, size_t workspace_size,
+    void *const *c,
+    const void *const *a,
+    const void *const *b,
+    float alpha,
+    float beta,
+    void *stream) {
+
+#define CALCULATE(CASE, NAMESPACE)                                                     \
+    case CASE:                                                                         \
+        return reinterpret_cast<const op::grouped_gemm::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                     \
+                        c, a, b,                                                       \
+                        alpha, beta,                                                   \
+                        stream)
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t
+infiniopDestroyGroupedGemmDescriptor(infiniopGroupedGemmDescriptor_t desc) {
+
+#define DELETE(CASE, NAMESPACE)                                                         \
+    case CASE:                                                                          \
+        delete reinterpret_cast<const op::grouped_gemm::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -0,0 +1,436 @@
+#include "int8_gemm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include <algorithm>
+
+namespace op::int8_gemm::cpu {
+
+namespace {
+
+// 每次内核调用计算的列数；行数不超过 MAX_ROWS，由指令集决定
+constexpr size_t COLS = 4;
+constexpr size_t MAX_ROWS = 4;
+
+// 每个任务负责的 C 块，A 的 TASK_ROWS 行留在 L2 中，B 的 COLS 列留在 L1 中
+constexpr size_t TASK_ROWS = 32;
+constexpr size_t TASK_COLS = 64;
+
+/**
+ * 计算 R 行 A 与 COLS 列 B 的点积：out[r * COLS + c] = sum_p(a[r * lda + p] * b[c * ldb + p])。
+ *
+ * - A 的行与 B 的列都按 k 连续；
+ * - 不足 COLS 列时重复计算最后一列，多余的结果由调用者丢弃；
+ * - VNNI 内核把 B 加上 128 作为无符号数参与乘法（vpdpbusd 为 u8 x s8），
+ *   结果多出 128 * sum_p(a[r * lda + p])，由调用者减去。
+ */
+using DotFn = void (*)(size_t k, const int8_t *a, ptrdiff_t lda, const int8_t *b, ptrdiff_t ldb, size_t cols, int32_t *out);
+
+struct Kernels {
+    // fn[r - 1] 计算 r 行
+    DotFn fn[MAX_ROWS];
+    size_t max_rows;
+    bool biased;
+};
+
+void columns(const int8_t *b, ptrdiff_t ldb, size_t cols, const int8_t *(&bc)[COLS]) {
+    for (size_t c = 0; c < COLS; ++c) {
+        bc[c] = b + std::min(c, cols - 1) * ldb;
+    }
+}
+
+template <size_t R>
+void dotGeneric(size_t k, const int8_t *a, ptrdiff_t lda, const int8_t *b, ptrdiff_t ldb, size_t cols, int32_t *out) {
+    const int8_t *bc[COLS];
+    columns(b, ldb, cols, bc);
+    for (size_t r = 0; r < R; ++r) {
+        for (size_t c = 0; c < COLS; ++c) {
+            int32_t sum = 0;
+            for (size_t p = 0; p < k; ++p) {
+                sum += int32_t(a[r * lda + p]) * int32_t(bc[c][p]);
+            }
+            out[r * COLS + c] = sum;
+        }
+    }
+}
+
+#ifdef INFINIOP_CPU_X86_SIMD
+
+// 以下内核中行、列的循环须完全展开，累加器才能留在寄存器中
+
+INFINIOP_CPU_TARGET("avx2,fma")
+inline int32_t hsum256(__m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4e));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xb1));
+    return _mm_cvtsi128_si32(s);
+}
+
+// 无 VNNI 时符号扩展为 int16 后用 vpmaddwd 计算，结果精确，不需要补偿
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma")
+void dotAvx2(size_t k, const int8_t *a, ptrdiff_t lda, const int8_t *b, ptrdiff_t ldb, size_t cols, int32_t *out) {
+    const int8_t *bc[COLS];
+    columns(b, ldb, cols, bc);
+    __m256i acc[R][COLS];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            acc[r][c] = _mm256_setzero_si256();
+        }
+    }
+    size_t p = 0;
+    for (; p + 16 <= k; p += 16) {
+        __m256i bv[COLS];
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            bv[c] = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(bc[c] + p)));
+        }
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            __m256i av = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + r * lda + p)));
+#pragma GCC unroll 4
+            for (size_t c = 0; c < COLS; ++c) {
+                acc[r][c] = _mm256_add_epi32(acc[r][c], _mm256_madd_epi16(av, bv[c]));
+            }
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            int32_t sum = hsum256(acc[r][c]);
+            for (size_t q = p; q < k; ++q) {
+                sum += int32_t(a[r * lda + q]) * int32_t(bc[c][q]);
+            }
+            out[r * COLS + c] = sum;
+        }
+    }
+}
+
+template <size_t R>
+INFINIOP_CPU_TARGET("avx2,fma,avxvnni")
+void dotAvxVnni(size_t k, const int8_t *a, ptrdiff_t lda, const int8_t *b, ptrdiff_t ldb, size_t cols, int32_t *out) {
+    const int8_t *bc[COLS];
+    columns(b, ldb, cols, bc);
+    const __m256i bias = _mm256_set1_epi8(char(0x80));
+    __m256i acc[R][COLS];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            acc[r][c] = _mm256_setzero_si256();
+        }
+    }
+    size_t p = 0;
+    for (; p + 32 <= k; p += 32) {
+        __m256i bv[COLS];
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            bv[c] = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(bc[c] + p)), bias);
+        }
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            __m256i av = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + r * lda + p));
+#pragma GCC unroll 4
+            for (size_t c = 0; c < COLS; ++c) {
+                acc[r][c] = _mm256_dpbusd_avx_epi32(acc[r][c], bv[c], av);
+            }
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            int32_t sum = hsum256(acc[r][c]);
+            // 尾部同样加上 128，与向量部分的偏置一致
+            for (size_t q = p; q < k; ++q) {
+                sum += int32_t(a[r * lda + q]) * (int32_t(bc[c][q]) + 128);
+            }
+            out[r * COLS + c] = sum;
+        }
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+// k 的尾部用掩码读取，被屏蔽的 A 为 0，对结果没有贡献
+template <size_t R>
+INFINIOP_CPU_TARGET("avx512f,avx512bw,avx512vnni")
+void dotAvx512Vnni(size_t k, const int8_t *a, ptrdiff_t lda, const int8_t *b, ptrdiff_t ldb, size_t cols, int32_t *out) {
+    const int8_t *bc[COLS];
+    columns(b, ldb, cols, bc);
+    const __m512i bias = _mm512_set1_epi8(char(0x80));
+    __m512i acc[R][COLS];
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            acc[r][c] = _mm512_setzero_si512();
+        }
+    }
+    for (size_t p = 0; p < k; p += 64) {
+        const __mmask64 mask = k - p >= 64 ? ~__mmask64(0) : (__mmask64(1) << (k - p)) - 1;
+        __m512i bv[COLS];
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            bv[c] = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, bc[c] + p), bias);
+        }
+#pragma GCC unroll 4
+        for (size_t r = 0; r < R; ++r) {
+            __m512i av = _mm512_maskz_loadu_epi8(mask, a + r * lda + p);
+#pragma GCC unroll 4
+            for (size_t c = 0; c < COLS; ++c) {
+                acc[r][c] = _mm512_dpbusd_epi32(acc[r][c], bv[c], av);
+            }
+        }
+    }
+#pragma GCC unroll 4
+    for (size_t r = 0; r < R; ++r) {
+#pragma GCC unroll 4
+        for (size_t c = 0; c < COLS; ++c) {
+            out[r * COLS + c] = _mm512_reduce_add_epi32(acc[r][c]);
+        }
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+// ymm 只有 16 个寄存器，每次计算 2 行，避免累加器溢出到内存
+const Kernels &kernels() {
+    static const Kernels table = [] {
+#ifdef INFINIOP_CPU_X86_SIMD
+        const auto &isa = device::cpu::isa();
+        if (isa.avx512_vnni) {
+            return Kernels{{dotAvx512Vnni<1>, dotAvx512Vnni<2>, dotAvx512Vnni<3>, dotAvx512Vnni<4>}, 4, true};
+        }
+        if (isa.avx_vnni) {
+            return Kernels{{dotAvxVnni<1>, dotAvxVnni<2>, nullptr, nullptr}, 2, true};
+        }
+        if (isa.avx2) {
+            return Kernels{{dotAvx2<1>, dotAvx2<2>, nullptr, nullptr}, 2, false};
+        }
+#endif
+        return Kernels{{dotGeneric<1>, dotGeneric<2>, dotGeneric<3>, dotGeneric<4>}, 4, false};
+    }();
+    return table;
+}
+
+int32_t rowSum(const int8_t *a, size_t k) {
+    int32_t sum = 0;
+    for (size_t p = 0; p < k; ++p) {
+        sum += a[p];
+    }
+    return sum;
+}
+
+size_t roundUp(size_t x, size_t align) {
+    return CEIL_DIV(x, align) * align;
+}
+
+// A 与 B 中不按 k 连续的操作数复制到工作空间，按 k 连续存放
+struct Operands {
+    bool copy_a, copy_b;
+    size_t a_batches, b_batches;
+};
+
+Operands operands(const gemm::MatmulInfo &info) {
+    return {info.a_matrix.col_stride != 1,
+            info.b_matrix.row_stride != 1,
+            info.a_matrix.stride == 0 ? size_t(1) : info.batch,
+            info.b_matrix.stride == 0 ? size_t(1) : info.batch};
+}
+
+size_t copyWorkspaceSize(const gemm::MatmulInfo &info) {
+    auto ops = operands(info);
+    size_t size = 0;
+    if (ops.copy_a) {
+        size += roundUp(ops.a_batches * info.m * info.k, 64);
+    }
+    if (ops.copy_b) {
+        size += ops.b_batches * info.n * info.k;
+    }
+    return size;
+}
+
+struct Scale {
+    const float *data;
+    ptrdiff_t stride, batch_stride;
+
+    float at(size_t batch, size_t i) const {
+        return data ? data[batch * batch_stride + i * stride] : 1.f;
+    }
+};
+
+template <typename Tout>
+void int8Gemm(
+    const Int8GemmInfo &info,
+    void *workspace,
+    Tout *c,
+    const int8_t *a,
+    const int8_t *b,
+    const float *a_scale,
+    const float *b_scale) {
+
+    const auto &mi = info.matmul;
+    const auto &am = mi.a_matrix;
+    const auto &bm = mi.b_matrix;
+    const auto &cm = mi.c_matrix;
+    const size_t m = mi.m, n = mi.n, k = mi.k;
+    if (m == 0 || n == 0 || mi.batch == 0) {
+        return;
+    }
+
+    // C 按列存放时 MatmulInfo 交换了 A 与 B，每行的缩放系数随之来自用户的 B
+    Scale row_scale{info.a_scale.present ? a_scale : nullptr, info.a_scale.stride, info.a_scale.batch_stride};
+    Scale col_scale{info.b_scale.present ? b_scale : nullptr, info.b_scale.stride, info.b_scale.batch_stride};
+    if (mi.is_transed) {
+        std::swap(a, b);
+        std::swap(row_scale, col_scale);
+    }
+
+    auto ops = operands(mi);
+    auto ws = reinterpret_cast<int8_t *>(workspace);
+    ptrdiff_t lda = am.row_stride, a_bs = am.stride;
+    ptrdiff_t ldb = bm.col_stride, b_bs = bm.stride;
+    if (ops.copy_a) {
+        for (size_t i = 0; i < ops.a_batches; ++i) {
+            for (size_t r = 0; r < m; ++r) {
+                for (size_t p = 0; p < k; ++p) {
+                    ws[(i * m + r) * k + p] = a[i * am.stride + r * am.row_stride + p * am.col_stride];
+                }
+            }
+        }
+        a = ws;
+        lda = ptrdiff_t(k);
+        a_bs = ops.a_batches == 1 ? 0 : ptrdiff_t(m * k);
+        ws += roundUp(ops.a_batches * m * k, 64);
+    }
+    if (ops.copy_b) {
+        for (size_t i = 0; i < ops.b_batches; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                for (size_t p = 0; p < k; ++p) {
+                    ws[(i * n + j) * k + p] = b[i * bm.stride + p * bm.row_stride + j * bm.col_stride];
+                }
+            }
+        }
+        b = ws;
+        ldb = ptrdiff_t(k);
+        b_bs = ops.b_batches == 1 ? 0 : ptrdiff_t(n * k);
+    }
+
+    const auto &table = kernels();
+    const size_t tiles_m = CEIL_DIV(m, TASK_ROWS);
+    const size_t tiles_n = CEIL_DIV(n, TASK_COLS);
+    const ptrdiff_t tasks = ptrdiff_t(mi.batch * tiles_m * tiles_n);
+
+#pragma omp parallel for schedule(static)
+    for (ptrdiff_t t = 0; t < tasks; ++t) {
+        const size_t tn = size_t(t) % tiles_n;
+        const size_t tm = size_t(t) / tiles_n % tiles_m;
+        const size_t batch = size_t(t) / tiles_n / tiles_m;
+        const size_t i0 = tm * TASK_ROWS, j0 = tn * TASK_COLS;
+        const size_t mb = std::min(TASK_ROWS, m - i0), nb = std::min(TASK_COLS, n - j0);
+
+        const int8_t *a_blk = a + batch * a_bs + i0 * lda;
+        const int8_t *b_blk = b + batch * b_bs + j0 * ldb;
+        Tout *c_blk = c + batch * cm.stride + i0 * cm.row_stride + j0 * cm.col_stride;
+
+        // VNNI 内核的偏置：128 * A 每行之和
+        int32_t bias[TASK_ROWS] = {};
+        if (table.biased) {
+            for (size_t i = 0; i < mb; ++i) {
+                bias[i] = 128 * rowSum(a_blk + i * lda, k);
+            }
+        }
+        float rs[TASK_ROWS];
+        for (size_t i = 0; i < mb; ++i) {
+            rs[i] = row_scale.at(batch, i0 + i);
+        }
+
+        int32_t out[MAX_ROWS * COLS];
+        for (size_t j = 0; j < nb; j += COLS) {
+            const size_t cols = std::min(COLS, nb - j);
+            float cs[COLS];
+            for (size_t jj = 0; jj < cols; ++jj) {
+                cs[jj] = col_scale.at(batch, j0 + j + jj);
+            }
+            for (size_t i = 0; i < mb; i += table.max_rows) {
+                const size_t rows = std::min(table.max_rows, mb - i);
+                table.fn[rows - 1](k, a_blk + i * lda, lda, b_blk + j * ldb, ldb, cols, out);
+                for (size_t ii = 0; ii < rows; ++ii) {
+                    Tout *c_ = c_blk + (i + ii) * cm.row_stride + j * cm.col_stride;
+                    for (size_t jj = 0; jj < cols; ++jj) {
+                        const float val = float(out[ii * COLS + jj] - bias[i + ii]) * rs[i + ii] * cs[jj];
+                        c_[jj * cm.col_stride] = utils::cast<Tout>(val);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+struct Descriptor::Opaque {};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t c_desc,
+    infiniopTensorDescriptor_t a_desc,
+    infiniopTensorDescriptor_t b_desc,
+    infiniopTensorDescriptor_t a_scale_desc,
+    infiniopTensorDescriptor_t b_scale_desc) {
+    auto result = Int8GemmInfo::create(c_desc, a_desc, b_desc, a_scale_desc, b_scale_desc);
+    CHECK_RESULT(result);
+    auto info = result.take();
+    size_t workspace_size = copyWorkspaceSize(info.matmul);
+    *desc_ptr = new Descriptor(nullptr, info, workspace_size, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *c,
+    const void *a,
+    const void *b,
+    const void *a_scale,
+    const void *b_scale,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    auto a_ = reinterpret_cast<const int8_t *>(a);
+    auto b_ = reinterpret_cast<const int8_t *>(b);
+    auto a_scale_ = reinterpret_cast<const float *>(a_scale);
+    auto b_scale_ = reinterpret_cast<const float *>(b_scale);
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        int8Gemm(_info, workspace, reinterpret_cast<fp16_t *>(c), a_, b_, a_scale_, b_scale_);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_BF16:
+        int8Gemm(_info, workspace, reinterpret_cast<bf16_t *>(c), a_, b_, a_scale_, b_scale_);
+        return INFINI_STATUS_SUCCESS;
+
+    case INFINI_DTYPE_F32:
+        int8Gemm(_info, workspace, reinterpret_cast<float *>(c), a_, b_, a_scale_, b_scale_);
+        return INFINI_STATUS_SUCCESS;
+
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::int8_gemm::cpu
@@ -0,0 +1,8 @@
+#ifndef __INT8_GEMM_CPU_H__
+#define __INT8_GEMM_CPU_H__
+
+#include "../int8_gemm.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __INT8_GEMM_CPU_H__
@@ -0,0 +1,83 @@
+#ifndef __INT8_GEMM_INFO_H__
+#define __INT8_GEMM_INFO_H__
+
+#include "../gemm/info.h"
+
+namespace op::int8_gemm {
+
+// 每行或每列的缩放系数：按元素计的步长，batch_stride 为 0 时所有批次共用
+struct ScaleLayout {
+    bool present;
+    ptrdiff_t stride;
+    ptrdiff_t batch_stride;
+
+    static utils::Result<ScaleLayout> create(
+        infiniopTensorDescriptor_t scale_desc,
+        size_t len,
+        size_t batch) {
+        if (scale_desc == nullptr) {
+            return utils::Result<ScaleLayout>(ScaleLayout{false, 0, 0});
+        }
+        if (scale_desc->dtype() != INFINI_DTYPE_F32) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        if (scale_desc->ndim() == 1 && scale_desc->dim(0) == len) {
+            return utils::Result<ScaleLayout>(ScaleLayout{true, scale_desc->stride(0), 0});
+        }
+        if (scale_desc->ndim() == 2 && scale_desc->dim(0) == batch && scale_desc->dim(1) == len) {
+            return utils::Result<ScaleLayout>(ScaleLayout{
+                true,
+                scale_desc->stride(1),
+                batch == 1 ? 0 : scale_desc->stride(0)});
+        }
+        return INFINI_STATUS_BAD_TENSOR_SHAPE;
+    }
+};
+
+class Int8GemmInfo {
+    Int8GemmInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+    gemm::MatmulInfo matmul;
+    ScaleLayout a_scale;
+    ScaleLayout b_scale;
+
+    static utils::Result<Int8GemmInfo> create(
+        infiniopTensorDescriptor_t c_desc,
+        infiniopTensorDescriptor_t a_desc,
+        infiniopTensorDescriptor_t b_desc,
+        infiniopTensorDescriptor_t a_scale_desc,
+        infiniopTensorDescriptor_t b_scale_desc) {
+
+        auto dtype = c_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_BF16);
+        if (a_desc->dtype() != INFINI_DTYPE_I8 || b_desc->dtype() != INFINI_DTYPE_I8) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+
+        // 用户的 A 与 B 在 MatmulInfo 中可能交换，缩放系数按用户的形状校验
+        auto a_matrix = gemm::BlasMatrix::create(a_desc);
+        CHECK_RESULT(a_matrix);
+        auto b_matrix = gemm::BlasMatrix::create(b_desc);
+        CHECK_RESULT(b_matrix);
+
+        auto a_scale = ScaleLayout::create(a_scale_desc, a_matrix->rows, a_matrix->batch);
+        CHECK_RESULT(a_scale);
+        auto b_scale = ScaleLayout::create(b_scale_desc, b_matrix->cols, b_matrix->batch);
+        CHECK_RESULT(b_scale);
+
+        auto matmul = gemm::MatmulInfo::create(c_desc, a_desc, b_desc, gemm::MatrixLayout::ROW_MAJOR);
+        CHECK_RESULT(matmul);
+
+        return utils::Result<Int8GemmInfo>(Int8GemmInfo{
+            dtype,
+            matmul.take(),
+            a_scale.take(),
+            b_scale.take()});
+    }
+};
+
+} // namespace op::int8_gemm
+
+#endif // __INT8_GEMM_INFO_H__
@@ -0,0 +1,168 @@
+#include "layer_norm_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+
+namespace op::layer_norm::cpu {
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_desc,
+    infiniopTensorDescriptor_t b_desc,
+    float epsilon) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = LayerNormInfo::create(y_desc, x_desc, w_desc, b_desc, epsilon);
+    CHECK_RESULT(result);
+
+    *desc_ptr = new Descriptor(result.take(), 0, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+namespace {
+
+/**
+ * 单遍 Welford 求一行的均值与（有偏）方差。
+ * 一个向量宽度的各条 lane 分别累积，所有 lane 的计数相同，每步只需一次除法，
+ * 结束后按 Chan 的公式合并各 lane，余下不足一个向量的元素逐个更新。
+ */
+template <typename Tc>
+void welford(const Tc *v, size_t len, Tc &mean, Tc &var) {
+    constexpr size_t LANES = 64 / sizeof(Tc);
+    Tc lane_mean[LANES] = {}, lane_m2[LANES] = {};
+
+    const size_t steps = len / LANES;
+    for (size_t s = 0; s < steps; ++s) {
+        const Tc *p = v + s * LANES;
+        const Tc inv = Tc(1) / Tc(s + 1);
+#pragma omp simd
+        for (size_t l = 0; l < LANES; ++l) {
+            const Tc d = p[l] - lane_mean[l];
+            lane_mean[l] += d * inv;
+            lane_m2[l] += d * (p[l] - lane_mean[l]);
+        }
+    }
+
+    Tc m = 0, m2 = 0;
+    size_t n = steps * LANES;
+    if (steps > 0) {
+        for (size_t l = 0; l < LANES; ++l) {
+            m += lane_mean[l];
+        }
+        m /= Tc(LANES);
+        for (size_t l = 0; l < LANES; ++l) {
+            const Tc d = lane_mean[l] - m;
+            m2 += lane_m2[l] + Tc(steps) * d * d;
+        }
+    }
+    for (size_t j = n; j < len; ++j) {
+        const Tc d = v[j] - m;
+        m += d / Tc(++n);
+        m2 += d * (v[j] - m);
+    }
+
+    mean = m;
+    var = n > 0 ? m2 / Tc(n) : Tc(0);
+}
+
+template <typename Tc>
+void normalize(Tc *y, const Tc *x, size_t len, Tc mean, Tc rstd, const Tc *w, const Tc *b) {
+    if (b) {
+#pragma omp simd
+        for (size_t j = 0; j < len; ++j) {
+            y[j] = (x[j] - mean) * rstd * w[j] + b[j];
+        }
+    } else {
+#pragma omp simd
+        for (size_t j = 0; j < len; ++j) {
+            y[j] = (x[j] - mean) * rstd * w[j];
+        }
+    }
+}
+
+// fp16/bf16 先转换到每个线程的 fp32 行缓冲区，统计量与归一化都在 fp32 中进行；w 与 b 在所有行之前转换一次
+template <typename T, typename Tw>
+void layerNorm(const LayerNormInfo &info, T *y, const T *x, const Tw *w, const Tw *b) {
+    using Tcompute = std::conditional_t<std::is_same_v<T, double>, double, float>;
+    constexpr bool half = !std::is_same_v<T, Tcompute>;
+    const auto &norm = info.norm;
+    const size_t batch = norm.shape[0], dim = norm.dim();
+
+    std::vector<Tcompute> weight(dim), bias(b ? dim : 0);
+    utils::convert_n(w, dim, weight.data());
+    if (b) {
+        utils::convert_n(b, dim, bias.data());
+    }
+    const Tcompute *bias_ = b ? bias.data() : nullptr;
+
+#pragma omp parallel
+    {
+        std::vector<float> buf(half ? dim : 0);
+
+#pragma omp for
+        for (ptrdiff_t i = 0; i < ptrdiff_t(batch); i++) {
+            T *y_ = y + i * norm.y_strides[0];
+            const T *x_ = x + i * norm.x_strides[0];
+
+            Tcompute mean, var;
+            if constexpr (!half) {
+                welford(x_, dim, mean, var);
+                const Tcompute rstd = Tcompute(1) / std::sqrt(var + Tcompute(norm.epsilon));
+                normalize(y_, x_, dim, mean, rstd, weight.data(), bias_);
+            } else {
+                utils::convert_n(x_, dim, buf.data());
+                welford(buf.data(), dim, mean, var);
+                const float rstd = 1.f / std::sqrt(var + norm.epsilon);
+                normalize(buf.data(), buf.data(), dim, mean, rstd, weight.data(), bias_);
+                utils::convert_n(buf.data(), dim, y_);
+            }
+        }
+    }
+}
+
+} // namespace
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace, size_t workspace_size,
+    void *y, const void *x, const void *w, const void *b,
+    void *stream) const {
+
+    if (!y || !x || !w) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (_info.has_bias != (b != nullptr)) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    const auto atype = _info.norm.atype, wtype = _info.norm.wtype;
+    if (atype == INFINI_DTYPE_F16) {
+        if (wtype == INFINI_DTYPE_F16) {
+            layerNorm(_info, (fp16_t *)y, (const fp16_t *)x, (const fp16_t *)w, (const fp16_t *)b);
+        } else if (wtype == INFINI_DTYPE_F32) {
+            layerNorm(_info, (fp16_t *)y, (const fp16_t *)x, (const float *)w, (const float *)b);
+        } else {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+    } else if (atype == INFINI_DTYPE_BF16) {
+        if (wtype == INFINI_DTYPE_BF16) {
+            layerNorm(_info, (bf16_t *)y, (const bf16_t *)x, (const bf16_t *)w, (const bf16_t *)b);
+        } else if (wtype == INFINI_DTYPE_F32) {
+            layerNorm(_info, (bf16_t *)y, (const bf16_t *)x, (const float *)w, (const float *)b);
+        } else {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+    } else if (atype == INFINI_DTYPE_F32) {
+        layerNorm(_info, (float *)y, (const float *)x, (const float *)w, (const float *)b);
+    } else if (atype == INFINI_DTYPE_F64) {
+        layerNorm(_info, (double *)y, (const double *)x, (const double *)w, (const double *)b);
+    } else {
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+    return INFINI_STATUS_SUCCESS;
+}
+
+} // namespace op::layer_norm::cpu
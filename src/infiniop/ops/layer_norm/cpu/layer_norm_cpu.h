@@ -0,0 +1,8 @@
+#ifndef __LAYER_NORM_CPU_H__
+#define __LAYER_NORM_CPU_H__
+
+#include "../layer_norm.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __LAYER_NORM_CPU_H__
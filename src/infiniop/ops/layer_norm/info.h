@@ -0,0 +1,45 @@
+#ifndef __LAYER_NORM_INFO_H__
+#define __LAYER_NORM_INFO_H__
+
+#include "../rms_norm/info.h"
+
+namespace op::layer_norm {
+
+class LayerNormInfo {
+    LayerNormInfo(rms_norm::RMSNormInfo norm_, bool has_bias_)
+        : norm(std::move(norm_)), has_bias(has_bias_) {}
+
+public:
+    // y、x、w 与 RMSNorm 相同，b 与 w 的类型和形状相同
+    rms_norm::RMSNormInfo norm;
+    bool has_bias;
+
+    static utils::Result<LayerNormInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t x_desc,
+        infiniopTensorDescriptor_t w_desc,
+        infiniopTensorDescriptor_t b_desc,
+        float epsilon) {
+
+        auto norm = rms_norm::RMSNormInfo::create(y_desc, x_desc, w_desc, epsilon);
+        CHECK_RESULT(norm);
+
+        if (b_desc) {
+            if (b_desc->dtype() != norm->wtype) {
+                return INFINI_STATUS_BAD_TENSOR_DTYPE;
+            }
+            if (b_desc->ndim() != 1 || b_desc->dim(0) != norm->dim()) {
+                return INFINI_STATUS_BAD_TENSOR_SHAPE;
+            }
+            if (b_desc->stride(0) != 1) {
+                return INFINI_STATUS_BAD_TENSOR_STRIDES;
+            }
+        }
+
+        return utils::Result<LayerNormInfo>(LayerNormInfo(norm.take(), b_desc != nullptr));
+    }
+};
+
+} // namespace op::layer_norm
+
+#endif // __LAYER_NORM_INFO_H__
@@ -1,5 +1,6 @@
 #include "random_sample_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
+#include "../../../devices/cpu/cpu_math.h"
 #include "../info.h"
 #include "infinicore.h"
 #include <algorithm>
@@ -52,6 +53,16 @@ struct Algo {
         return utils::cast<typename ComputeType<Tval>::type, Tval>(reinterpret_cast<Tval const *>(ptr)[i]);
     }
 
+    static void exp(float *v, size_t n) {
+        device::cpu::math::exp(v, v, n);
+    }
+
+    static void exp(double *v, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            v[i] = std::exp(v[i]);
+        }
+    }
+
     template <class Tidx, class Tval>
     infiniStatus_t argmax(
         void *workspace, size_t workspace_size,
@@ -94,11 +105,21 @@ struct Algo {
             pairs[i] = {static_cast<Tidx>(i), get<Tidx, Tval>(probs, i)};
         }
         std::sort(pairs.begin(), pairs.end());
-        // softmax & sum
+        // softmax & sum：按块把 (val - max) / temperature 放入栈上的缓冲区计算 exp，再累加前缀和
+        using Tcompute = typename ComputeType<Tval>::type;
+        constexpr size_t BLOCK = 256;
+        Tcompute block[BLOCK];
         auto const max_val = pairs[0].val;
-        pairs[0].val = 1;
-        for (size_t i = 1; i < n; i++) {
-            pairs[i].val = pairs[i - 1].val + std::exp((pairs[i].val - max_val) / temperature);
+        Tcompute sum = 0;
+        for (size_t i = 0; i < n; i += BLOCK) {
+            const size_t len = std::min(BLOCK, n - i);
+            for (size_t j = 0; j < len; j++) {
+                block[j] = (pairs[i + j].val - max_val) / temperature;
+            }
+            exp(block, len);
+            for (size_t j = 0; j < len; j++) {
+                pairs[i + j].val = sum += block[j];
+            }
         }
         // topk & topp & limit
         auto const pk = pairs[std::min(static_cast<size_t>(topk), n) - 1].val,
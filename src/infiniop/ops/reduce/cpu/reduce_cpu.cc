@@ -0,0 +1,385 @@
+#include "reduce_cpu.h"
+#include "../../../elementwise/cpu/elementwise_cpu.h"
+#include "../../../reduce/cpu/reduce.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace op::reduce::cpu {
+
+namespace {
+
+// 输出比线程少、且每个输出要规约的元素不少于这个数时，由多个线程分担同一个输出
+constexpr size_t TREE_MIN_REDUCE_SIZE = 4096;
+// 每次处理的输出个数，累加器放在栈上
+constexpr size_t BLOCK = 1024;
+
+// 分担规约的线程数，为 1 时按输出划分线程
+size_t treeThreads(const ReduceInfo &info) {
+#ifdef ENABLE_OMP
+    const size_t threads = size_t(omp_get_max_threads());
+#else
+    const size_t threads = 1;
+#endif
+    return info.output_size < threads && info.reduce_size >= TREE_MIN_REDUCE_SIZE ? threads : 1;
+}
+
+} // namespace
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    const size_t *axes,
+    size_t axis_count,
+    int keepdim,
+    infiniopReduceOp_t op) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = ReduceInfo::create(y_desc, x_desc, axes, axis_count, keepdim != 0, op);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    // 分担规约时每个线程在工作空间中保存全部输出的部分结果
+    const size_t threads = treeThreads(info);
+    const size_t workspace_size = threads > 1 ? threads * info.output_size * sizeof(double) : 0;
+
+    *desc_ptr = new Descriptor(std::move(info), workspace_size, handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+namespace {
+
+// 按行优先顺序遍历下标并维护对应的偏移，前进时只做加法
+class Odometer {
+    const std::vector<size_t> &_shape;
+    const std::vector<ptrdiff_t> &_strides;
+    std::vector<size_t> _index;
+    ptrdiff_t _offset = 0;
+
+public:
+    Odometer(const std::vector<size_t> &shape, const std::vector<ptrdiff_t> &strides, size_t flat_index)
+        : _shape(shape), _strides(strides), _index(shape.size()) {
+        for (size_t i = shape.size(); i-- > 0;) {
+            _index[i] = flat_index % shape[i];
+            flat_index /= shape[i];
+            _offset += ptrdiff_t(_index[i]) * strides[i];
+        }
+    }
+
+    ptrdiff_t offset() const { return _offset; }
+
+    // 最内层维度上还剩的长度
+    size_t innerRemaining() const { return _shape.back() - _index.back(); }
+
+    // 前进 n 步，n 不超过 innerRemaining()
+    void next(size_t n = 1) {
+        if (_index.empty()) {
+            return;
+        }
+        size_t i = _index.size() - 1;
+        _index[i] += n;
+        _offset += ptrdiff_t(n) * _strides[i];
+        while (_index[i] == _shape[i] && i > 0) {
+            _offset -= ptrdiff_t(_shape[i]) * _strides[i];
+            _index[i] = 0;
+            --i;
+            ++_index[i];
+            _offset += _strides[i];
+        }
+    }
+};
+
+constexpr bool isSum(infiniopReduceOp_t op) {
+    return op == INFINIOP_REDUCE_SUM || op == INFINIOP_REDUCE_MEAN || op == INFINIOP_REDUCE_L2;
+}
+
+template <infiniopReduceOp_t Op>
+constexpr float identity() {
+    if constexpr (Op == INFINIOP_REDUCE_MAX) {
+        return -std::numeric_limits<float>::infinity();
+    } else if constexpr (Op == INFINIOP_REDUCE_MIN) {
+        return std::numeric_limits<float>::infinity();
+    } else if constexpr (Op == INFINIOP_REDUCE_PROD) {
+        return 1.f;
+    } else {
+        return 0.f;
+    }
+}
+
+// 把一个元素累加到累加器上；max/min 在任一操作数为 NaN 时得到 NaN
+template <infiniopReduceOp_t Op>
+inline float accumulate(float acc, float val) {
+    if constexpr (Op == INFINIOP_REDUCE_MAX) {
+        return acc > val || acc != acc ? acc : val;
+    } else if constexpr (Op == INFINIOP_REDUCE_MIN) {
+        return acc < val || acc != acc ? acc : val;
+    } else if constexpr (Op == INFINIOP_REDUCE_PROD) {
+        return acc * val;
+    } else if constexpr (Op == INFINIOP_REDUCE_L2) {
+        return acc + val * val;
+    } else {
+        return acc + val;
+    }
+}
+
+// 合并两个部分结果
+template <infiniopReduceOp_t Op>
+inline double merge(double a, double b) {
+    if constexpr (Op == INFINIOP_REDUCE_MAX) {
+        return a > b || a != a ? a : b;
+    } else if constexpr (Op == INFINIOP_REDUCE_MIN) {
+        return a < b || a != a ? a : b;
+    } else if constexpr (Op == INFINIOP_REDUCE_PROD) {
+        return a * b;
+    } else {
+        return a + b;
+    }
+}
+
+template <infiniopReduceOp_t Op>
+inline float finalize(double acc, size_t reduce_size) {
+    if constexpr (Op == INFINIOP_REDUCE_MEAN) {
+        return float(acc / double(reduce_size));
+    } else if constexpr (Op == INFINIOP_REDUCE_L2) {
+        return float(std::sqrt(acc));
+    } else {
+        return float(acc);
+    }
+}
+
+// 规约等步长的一段，连续时走 reduce_op 的向量路径
+template <infiniopReduceOp_t Op, typename T>
+inline float reduceRun(const T *x, size_t len, ptrdiff_t stride) {
+    using namespace op::common_cpu;
+    if constexpr (Op == INFINIOP_REDUCE_MAX) {
+        return reduce_op::max(x, len, stride);
+    } else if constexpr (Op == INFINIOP_REDUCE_MIN) {
+        return reduce_op::min(x, len, stride);
+    } else if constexpr (Op == INFINIOP_REDUCE_PROD) {
+        return reduce_op::prod(x, len, stride);
+    } else if constexpr (Op == INFINIOP_REDUCE_L2) {
+        return reduce_op::sumSquared(x, len, stride);
+    } else {
+        return reduce_op::sum(x, len, stride);
+    }
+}
+
+/**
+ * x 的最内层维度被规约（或者保留的维度在 x 中都不连续）时，逐个输出规约：
+ * 每个输出按最内层被规约的维度分成若干段，每段交给 reduceRun，段间在 double 中合并。
+ * 只规约被规约部分的下标 [r_begin, r_end)，结果写入 out[0, m_end - m_begin)。
+ */
+template <infiniopReduceOp_t Op, typename T>
+void accumulateRows(const ReduceInfo &info, const T *x, double *out,
+                    size_t m_begin, size_t m_end, size_t r_begin, size_t r_end) {
+    // 没有被规约的维度时每个输出就是一个元素
+    const bool scalar = info.reduce_shape.empty();
+    const ptrdiff_t stride = scalar ? 0 : info.reduce_strides.back();
+
+    Odometer xo(info.shape, info.x_strides, m_begin);
+    for (size_t m = m_begin; m < m_end; ++m, xo.next()) {
+        double acc = identity<Op>();
+        Odometer ro(info.reduce_shape, info.reduce_strides, r_begin);
+        for (size_t r = r_begin; r < r_end;) {
+            const size_t len = scalar ? 1 : std::min(ro.innerRemaining(), r_end - r);
+            acc = merge<Op>(acc, reduceRun<Op>(x + xo.offset() + ro.offset(), len, stride));
+            ro.next(len);
+            r += len;
+        }
+        out[m - m_begin] = acc;
+    }
+}
+
+/**
+ * x 的最内层维度被保留且连续时，按被规约的下标逐行累加：每一行把这一块输出对应的
+ * 若干连续段转换成 fp32，再与累加器逐元素合并，编译器可以向量化。
+ *
+ * 输出很窄时（x 形如 [..., R, L]，块恰好是整个 L），相邻的 fold 行在内存中连续，
+ * 一次转换并用 fold 组累加器分别累加，最后再合并，避免每行只处理 L 个元素。
+ */
+template <infiniopReduceOp_t Op, typename T>
+void accumulateColumns(const ReduceInfo &info, const T *x, double *out,
+                       size_t m_begin, size_t m_end, size_t r_begin, size_t r_end) {
+    const bool compensated = isSum(Op) && op::common_cpu::reduce_op::defaultSummation() == op::common_cpu::reduce_op::Summation::COMPENSATED;
+
+    for (size_t block = m_begin; block < m_end; block += BLOCK) {
+        const size_t n = std::min(BLOCK, m_end - block);
+
+        // 这一块输出在最内层保留维度上分成的段：段在块中的起点与在 x 中的偏移
+        size_t run_begin[BLOCK + 1];
+        ptrdiff_t run_offset[BLOCK];
+        size_t runs = 0;
+        Odometer xo(info.shape, info.x_strides, block);
+        for (size_t j = 0; j < n; ++runs) {
+            const size_t len = std::min(xo.innerRemaining(), n - j);
+            run_begin[runs] = j;
+            run_offset[runs] = xo.offset();
+            xo.next(len);
+            j += len;
+        }
+        run_begin[runs] = n;
+
+        const bool foldable = runs == 1 && n == info.shape.back()
+                           && !info.reduce_shape.empty() && info.reduce_strides.back() == ptrdiff_t(n);
+        const size_t fold = foldable ? BLOCK / n : 1;
+
+        float acc[BLOCK], comp[BLOCK], buf[BLOCK];
+        std::fill_n(acc, fold * n, identity<Op>());
+        std::fill_n(comp, fold * n, 0.f);
+
+        Odometer ro(info.reduce_shape, info.reduce_strides, r_begin);
+        for (size_t r = r_begin; r < r_end;) {
+            const size_t rows = fold == 1 ? 1 : std::min({fold, ro.innerRemaining(), r_end - r});
+            const size_t lanes = rows * n;
+            if (fold == 1) {
+                for (size_t k = 0; k < runs; ++k) {
+                    utils::convert_n(x + run_offset[k] + ro.offset(), run_begin[k + 1] - run_begin[k], buf + run_begin[k]);
+                }
+            } else {
+                utils::convert_n(x + run_offset[0] + ro.offset(), lanes, buf);
+            }
+            if (compensated) {
+                for (size_t j = 0; j < lanes; ++j) {
+                    const float val = Op == INFINIOP_REDUCE_L2 ? buf[j] * buf[j] : buf[j];
+                    const float y = val - comp[j];
+                    const float t = acc[j] + y;
+                    comp[j] = (t - acc[j]) - y;
+                    acc[j] = t;
+                }
+            } else {
+#pragma omp simd
+                for (size_t j = 0; j < lanes; ++j) {
+                    acc[j] = accumulate<Op>(acc[j], buf[j]);
+                }
+            }
+            ro.next(rows);
+            r += rows;
+        }
+
+        for (size_t j = 0; j < n; ++j) {
+            double result = double(acc[j]) - double(comp[j]);
+            for (size_t i = 1; i < fold; ++i) {
+                result = merge<Op>(result, double(acc[i * n + j]) - double(comp[i * n + j]));
+            }
+            out[block - m_begin + j] = result;
+        }
+    }
+}
+
+template <infiniopReduceOp_t Op, typename T>
+void accumulateOutputs(const ReduceInfo &info, const T *x, double *out,
+                       size_t m_begin, size_t m_end, size_t r_begin, size_t r_end) {
+    const bool columns = !info.shape.empty() && info.x_strides.back() == 1
+                      && (info.reduce_shape.empty() || info.reduce_strides.back() != 1);
+    if (columns) {
+        accumulateColumns<Op>(info, x, out, m_begin, m_end, r_begin, r_end);
+    } else {
+        accumulateRows<Op>(info, x, out, m_begin, m_end, r_begin, r_end);
+    }
+}
+
+template <infiniopReduceOp_t Op, typename T>
+void compute(const ReduceInfo &info, size_t tree_threads, double *partials, T *y, const T *x) {
+    const size_t output_size = info.output_size, reduce_size = info.reduce_size;
+
+    if (tree_threads > 1) {
+        // 输出太少：各线程规约所有输出的一部分，再合并各线程的部分结果
+#pragma omp parallel num_threads(tree_threads)
+        {
+#ifdef ENABLE_OMP
+            const size_t threads = size_t(omp_get_num_threads());
+            const size_t tid = size_t(omp_get_thread_num());
+#else
+            const size_t threads = 1, tid = 0;
+#endif
+            auto [r_begin, r_end] = elementwise::cpu::threadRange(reduce_size);
+            accumulateOutputs<Op>(info, x, partials + tid * output_size, 0, output_size, r_begin, r_end);
+#pragma omp barrier
+            auto [m_begin, m_end] = elementwise::cpu::threadRange(output_size);
+            Odometer yo(info.shape, info.y_strides, m_begin);
+            for (size_t m = m_begin; m < m_end; ++m, yo.next()) {
+                double acc = partials[m];
+                for (size_t t = 1; t < threads; ++t) {
+                    acc = merge<Op>(acc, partials[t * output_size + m]);
+                }
+                y[yo.offset()] = utils::cast<T>(finalize<Op>(acc, reduce_size));
+            }
+        }
+        return;
+    }
+
+#pragma omp parallel
+    {
+        auto [m_begin, m_end] = elementwise::cpu::threadRange(output_size);
+        Odometer yo(info.shape, info.y_strides, m_begin);
+        double out[BLOCK];
+        for (size_t block = m_begin; block < m_end; block += BLOCK) {
+            const size_t n = std::min(BLOCK, m_end - block);
+            accumulateOutputs<Op>(info, x, out, block, block + n, 0, reduce_size);
+            for (size_t j = 0; j < n; ++j, yo.next()) {
+                y[yo.offset()] = utils::cast<T>(finalize<Op>(out[j], reduce_size));
+            }
+        }
+    }
+}
+
+template <typename T>
+infiniStatus_t dispatchOp(const ReduceInfo &info, size_t tree_threads, double *partials, void *y, const void *x) {
+#define CASE(OP)                                                                                             \
+    case OP:                                                                                                 \
+        compute<OP>(info, tree_threads, partials, reinterpret_cast<T *>(y), reinterpret_cast<const T *>(x)); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (info.op) {
+        CASE(INFINIOP_REDUCE_SUM);
+        CASE(INFINIOP_REDUCE_MEAN);
+        CASE(INFINIOP_REDUCE_MAX);
+        CASE(INFINIOP_REDUCE_MIN);
+        CASE(INFINIOP_REDUCE_PROD);
+        CASE(INFINIOP_REDUCE_L2);
+    default:
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+#undef CASE
+}
+
+} // namespace
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    void *stream) const {
+
+    if (!y || !x) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    if (_info.output_size == 0) {
+        return INFINI_STATUS_SUCCESS;
+    }
+
+    const size_t tree_threads = _workspace_size / (_info.output_size * sizeof(double));
+    auto partials = reinterpret_cast<double *>(workspace);
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        return dispatchOp<fp16_t>(_info, tree_threads, partials, y, x);
+    case INFINI_DTYPE_BF16:
+        return dispatchOp<bf16_t>(_info, tree_threads, partials, y, x);
+    case INFINI_DTYPE_F32:
+        return dispatchOp<float>(_info, tree_threads, partials, y, x);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::reduce::cpu
@@ -0,0 +1,8 @@
+#ifndef __REDUCE_CPU_H__
+#define __REDUCE_CPU_H__
+
+#include "../reduce.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __REDUCE_CPU_H__
@@ -0,0 +1,145 @@
+#ifndef __REDUCE_INFO_H__
+#define __REDUCE_INFO_H__
+
+#include "../../../utils.h"
+#include "../../tensor.h"
+#include "infiniop/ops/reduce.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace op::reduce {
+
+class ReduceInfo {
+    ReduceInfo() = default;
+
+    // 合并相邻且在内存中连续的维度：前一维的步长恰好是后一维的步长乘以长度
+    static void mergeDims(std::vector<size_t> &shape, std::vector<std::vector<ptrdiff_t>> &strides) {
+        size_t n = 0;
+        for (size_t i = 0; i < shape.size(); ++i) {
+            bool mergeable = n > 0;
+            for (const auto &s : strides) {
+                mergeable = mergeable && s[n - 1] == s[i] * ptrdiff_t(shape[i]);
+            }
+            if (mergeable) {
+                shape[n - 1] *= shape[i];
+                for (auto &s : strides) {
+                    s[n - 1] = s[i];
+                }
+            } else {
+                shape[n] = shape[i];
+                for (auto &s : strides) {
+                    s[n] = s[i];
+                }
+                ++n;
+            }
+        }
+        shape.resize(n);
+        for (auto &s : strides) {
+            s.resize(n);
+        }
+    }
+
+public:
+    infiniDtype_t dtype;
+    infiniopReduceOp_t op;
+    // 保留的维度（即输出的维度）及其在 y 与 x 中的步长
+    std::vector<size_t> shape;
+    std::vector<ptrdiff_t> y_strides, x_strides;
+    // 被规约的维度及其在 x 中的步长，按步长从大到小排列
+    std::vector<size_t> reduce_shape;
+    std::vector<ptrdiff_t> reduce_strides;
+    // 以上两组都去掉了长度为 1 的维度并合并了连续的维度
+    size_t output_size, reduce_size;
+
+    static utils::Result<ReduceInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t x_desc,
+        const size_t *axes,
+        size_t axis_count,
+        bool keepdim,
+        infiniopReduceOp_t op) {
+
+        if (!y_desc || !x_desc || (axis_count > 0 && !axes)) {
+            return INFINI_STATUS_NULL_POINTER;
+        }
+
+        const auto dtype = x_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_OR_RETURN(y_desc->dtype() == dtype, INFINI_STATUS_BAD_TENSOR_DTYPE);
+        CHECK_OR_RETURN(op >= INFINIOP_REDUCE_SUM && op <= INFINIOP_REDUCE_L2, INFINI_STATUS_BAD_PARAM);
+
+        const size_t ndim = x_desc->ndim();
+        std::vector<bool> reduced(ndim, false);
+        for (size_t i = 0; i < axis_count; ++i) {
+            CHECK_OR_RETURN(axes[i] < ndim && !reduced[axes[i]], INFINI_STATUS_BAD_PARAM);
+            reduced[axes[i]] = true;
+        }
+        CHECK_OR_RETURN(y_desc->ndim() == (keepdim ? ndim : ndim - axis_count), INFINI_STATUS_BAD_TENSOR_SHAPE);
+        CHECK_OR_RETURN(!y_desc->hasBroadcastDim(), INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        ReduceInfo info;
+        info.dtype = dtype;
+        info.op = op;
+        info.output_size = 1;
+        info.reduce_size = 1;
+        // j 是 x 的第 i 维在 y 中对应的维度
+        for (size_t i = 0, j = 0; i < ndim; ++i) {
+            const size_t len = x_desc->dim(i);
+            if (reduced[i]) {
+                if (keepdim) {
+                    CHECK_OR_RETURN(y_desc->dim(j++) == 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
+                }
+                info.reduce_size *= len;
+                if (len != 1) {
+                    info.reduce_shape.push_back(len);
+                    info.reduce_strides.push_back(x_desc->stride(i));
+                }
+            } else {
+                CHECK_OR_RETURN(y_desc->dim(j) == len, INFINI_STATUS_BAD_TENSOR_SHAPE);
+                info.output_size *= len;
+                if (len != 1) {
+                    info.shape.push_back(len);
+                    info.y_strides.push_back(y_desc->stride(j));
+                    info.x_strides.push_back(x_desc->stride(i));
+                }
+                ++j;
+            }
+        }
+
+        // 空规约没有要遍历的下标，也就不需要被规约的维度
+        if (info.reduce_size == 0) {
+            info.reduce_shape.clear();
+            info.reduce_strides.clear();
+        }
+
+        // 规约的顺序不影响结果，让步长最小的维度在最内层，尽量连续地读 x
+        std::vector<size_t> order(info.reduce_shape.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return std::abs(info.reduce_strides[a]) > std::abs(info.reduce_strides[b]);
+        });
+        std::vector<size_t> reduce_shape;
+        std::vector<std::vector<ptrdiff_t>> reduce_strides(1);
+        for (auto i : order) {
+            reduce_shape.push_back(info.reduce_shape[i]);
+            reduce_strides[0].push_back(info.reduce_strides[i]);
+        }
+        mergeDims(reduce_shape, reduce_strides);
+        info.reduce_shape = std::move(reduce_shape);
+        info.reduce_strides = std::move(reduce_strides[0]);
+
+        std::vector<std::vector<ptrdiff_t>> strides{std::move(info.y_strides), std::move(info.x_strides)};
+        mergeDims(info.shape, strides);
+        info.y_strides = std::move(strides[0]);
+        info.x_strides = std::move(strides[1]);
+
+        return utils::Result<ReduceInfo>(std::move(info));
+    }
+};
+
+} // namespace op::reduce
+
+#endif // __REDUCE_INFO_H__
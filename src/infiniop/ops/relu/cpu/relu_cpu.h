@@ -16,6 +16,17 @@ public:
     T operator()(const T &x) const {
         return std::max<T>(x, 0);
     }
+#ifdef INFINIOP_CPU_X86_SIMD
+    // 0 放在第一个操作数，NaN 与 std::max 一样原样传出
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+    __m256 operator()(__m256 x) const {
+        return _mm256_max_ps(_mm256_setzero_ps(), x);
+    }
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+    __m512 operator()(__m512 x) const {
+        return _mm512_max_ps(_mm512_setzero_ps(), x);
+    }
+#endif
 } ReluOp;
 } // namespace op::relu::cpu
 
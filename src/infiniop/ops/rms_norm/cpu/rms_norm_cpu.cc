@@ -19,52 +19,54 @@ infiniStatus_t Descriptor::create(
     return INFINI_STATUS_SUCCESS;
 }
 
-template <typename T>
-infiniStatus_t rmsnorm(const RMSNormInfo *info, T *y, const T *x, const T *w) {
-#pragma omp parallel for
-    for (ptrdiff_t i = 0; i < ptrdiff_t(info->shape[0]); i++) {
-        T *x_ = (T *)(x + i * info->x_strides[0]);
-        T *y_ = (T *)(y + i * info->y_strides[0]);
-
-        // [Reduce] sum of x^2 on last dimension
-        T ss = op::common_cpu::reduce_op::sumSquared(x_, info->shape[1], info->x_strides[1]);
-
-        // 1 / (sqrt(sum/dim + eps))
-        T rms = (T)1 / std::sqrt(ss / (T)(info->shape[1]) + (T)(info->epsilon));
-
-        for (size_t j = 0; j < info->shape[1]; j++) {
-            y_[j * info->y_strides[1]] = x_[j * info->x_strides[1]] * w[j] * rms;
-        }
-    }
-
-    return INFINI_STATUS_SUCCESS;
-}
-
+/**
+ * x、y 的最后一维与 w 在创建描述符时已校验为连续，逐行读一次 x：
+ * 用 reduce_op::sumSquared 求平方和，再乘以 w 与 1/rms 写入 y。
+ * w 在所有行之前转换为计算类型一次，fp16/bf16 的行先展开到每个线程的 fp32 缓冲区。
+ */
 template <typename T, typename Tw>
-infiniStatus_t rmsnormHalfPrecision(const RMSNormInfo *info, T *y, const T *x, const Tw *w) {
-    static_assert(std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value,
-                  "T must be fp16_t or bf16_t");
-
-#pragma omp parallel for
-    for (ptrdiff_t i = 0; i < ptrdiff_t(info->shape[0]); i++) {
-        T *x_ = (T *)(x + i * info->x_strides[0]);
-        T *y_ = (T *)(y + i * info->y_strides[0]);
-
-        // [Reduce] sum of x^2 on last dimension
-        float ss = op::common_cpu::reduce_op::sumSquared(x_, info->shape[1], info->x_strides[1]);
-
-        // 1 / (sqrt(sum/dim + eps))
-        float rms = 1.f / std::sqrt(ss / (float)(info->shape[1]) + info->epsilon);
+infiniStatus_t rmsnorm(const RMSNormInfo *info, T *y, const T *x, const Tw *w) {
+    using Tcompute = std::conditional_t<std::is_same_v<T, double>, double, float>;
+    constexpr bool half = !std::is_same_v<T, Tcompute>;
+    const size_t batch = info->shape[0], dim = info->dim();
+
+    std::vector<Tcompute> weight;
+    const Tcompute *w_ = nullptr;
+    if constexpr (std::is_same_v<Tw, Tcompute>) {
+        w_ = w;
+    } else {
+        weight.resize(dim);
+        utils::convert_n(w, dim, weight.data());
+        w_ = weight.data();
+    }
 
-        for (size_t j = 0; j < info->shape[1]; j++) {
-            if constexpr (std::is_same<Tw, float>::value) {
-                float val = utils::cast<float>(x_[j * info->x_strides[1]]) * w[j] * rms;
-                y_[j * info->y_strides[1]] = utils::cast<T>(val);
-            } else if constexpr (std::is_same<Tw, T>::value) {
-                float val = utils::cast<float>(x_[j * info->x_strides[1]]) * utils::cast<float>(w[j]) * rms;
-                y_[j * info->y_strides[1]] = utils::cast<T>(val);
+#pragma omp parallel
+    {
+        std::vector<float> buf(half ? dim : 0);
+
+#pragma omp for
+        for (ptrdiff_t i = 0; i < ptrdiff_t(batch); i++) {
+            T *y_ = y + i * info->y_strides[0];
+            const T *x_ = x + i * info->x_strides[0];
+
+            if constexpr (!half) {
+                // [Reduce] sum of x^2 on last dimension
+                const Tcompute ss = op::common_cpu::reduce_op::sumSquared(x_, dim);
+                // 1 / (sqrt(sum/dim + eps))
+                const Tcompute rms = Tcompute(1) / std::sqrt(ss / Tcompute(dim) + Tcompute(info->epsilon));
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    y_[j] = x_[j] * w_[j] * rms;
+                }
             } else {
-                std::abort();
+                utils::convert_n(x_, dim, buf.data());
+                const float ss = op::common_cpu::reduce_op::sumSquared(buf.data(), dim);
+                const float rms = 1.f / std::sqrt(ss / float(dim) + info->epsilon);
+#pragma omp simd
+                for (size_t j = 0; j < dim; j++) {
+                    buf[j] *= w_[j] * rms;
+                }
+                utils::convert_n(buf.data(), dim, y_);
             }
         }
     }
@@ -78,24 +80,24 @@ infiniStatus_t Descriptor::calculate(
     void *stream) const {
     if (_info.atype == INFINI_DTYPE_F16) {
         if (_info.wtype == INFINI_DTYPE_F16) {
-            CHECK_STATUS(rmsnormHalfPrecision(&_info, (fp16_t *)y, (const fp16_t *)x, (const fp16_t *)w));
+            CHECK_STATUS(rmsnorm(&_info, (fp16_t *)y, (const fp16_t *)x, (const fp16_t *)w));
         } else if (_info.wtype == INFINI_DTYPE_F32) {
-            CHECK_STATUS(rmsnormHalfPrecision(&_info, (fp16_t *)y, (const fp16_t *)x, (const float *)w));
+            CHECK_STATUS(rmsnorm(&_info, (fp16_t *)y, (const fp16_t *)x, (const float *)w));
         } else {
             return INFINI_STATUS_BAD_TENSOR_DTYPE;
         }
     } else if (_info.atype == INFINI_DTYPE_BF16) {
         if (_info.wtype == INFINI_DTYPE_BF16) {
-            CHECK_STATUS(rmsnormHalfPrecision(&_info, (bf16_t *)y, (const bf16_t *)x, (const bf16_t *)w));
+            CHECK_STATUS(rmsnorm(&_info, (bf16_t *)y, (const bf16_t *)x, (const bf16_t *)w));
         } else if (_info.wtype == INFINI_DTYPE_F32) {
-            CHECK_STATUS(rmsnormHalfPrecision(&_info, (bf16_t *)y, (const bf16_t *)x, (const float *)w));
+            CHECK_STATUS(rmsnorm(&_info, (bf16_t *)y, (const bf16_t *)x, (const float *)w));
         } else {
             return INFINI_STATUS_BAD_TENSOR_DTYPE;
         }
     } else if (_info.atype == INFINI_DTYPE_F32) {
-        CHECK_STATUS(rmsnorm(&_info, (float *)y, (float *)x, (float *)w));
+        CHECK_STATUS(rmsnorm(&_info, (float *)y, (const float *)x, (const float *)w));
     } else if (_info.atype == INFINI_DTYPE_F64) {
-        CHECK_STATUS(rmsnorm(&_info, (double *)y, (double *)x, (double *)w));
+        CHECK_STATUS(rmsnorm(&_info, (double *)y, (const double *)x, (const double *)w));
     } else {
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
@@ -1,6 +1,7 @@
 #ifndef __SWIGLU_CPU_H__
 #define __SWIGLU_CPU_H__
 
+#include "../../../devices/cpu/cpu_math.h"
 #include "../../../elementwise/cpu/elementwise_cpu.h"
 
 ELEMENTWISE_DESCRIPTOR(swiglu, cpu)
@@ -19,6 +20,16 @@ public:
     T operator()(const T &up, const T &gate) const {
         return gate * sigmoid(gate) * up;
     }
+#ifdef INFINIOP_CPU_X86_SIMD
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+    __m256 operator()(__m256 up, __m256 gate) const {
+        return _mm256_mul_ps(device::cpu::math::siluAvx2(gate), up);
+    }
+    INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+    __m512 operator()(__m512 up, __m512 gate) const {
+        return _mm512_mul_ps(device::cpu::math::siluAvx512(gate), up);
+    }
+#endif
 } SwiGLUOp;
 } // namespace op::swiglu::cpu
 
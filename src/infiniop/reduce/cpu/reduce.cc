@@ -1,59 +1,391 @@
 #include "reduce.h"
+#include "../../elementwise/cpu/elementwise_cpu_simd.h"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 
 namespace op::common_cpu::reduce_op {
 
-template <typename HalfType>
-float sum_half_impl(const HalfType *data, size_t len, ptrdiff_t stride) {
-    float result = 0;
-    for (size_t i = 0; i < len; i++) {
-        result += utils::cast<float>(data[i * stride]);
+Summation defaultSummation() {
+    static const Summation summation = [] {
+        const char *compensated = std::getenv("INFINIOP_CPU_COMPENSATED_SUM");
+        return compensated && std::strcmp(compensated, "1") == 0 ? Summation::COMPENSATED : Summation::FAST;
+    }();
+    return summation;
+}
+
+namespace {
+
+enum class Kind {
+    SUM,
+    SUM_SQUARED,
+    MAX,
+    MIN,
+    PROD,
+};
+
+// 只有求和类的规约才需要（也才能做）补偿
+constexpr bool isSum(Kind k) {
+    return k == Kind::SUM || k == Kind::SUM_SQUARED;
+}
+
+// 规约的单位元，空序列的结果，也用于填充尾部
+template <Kind K>
+constexpr float identity() {
+    if constexpr (K == Kind::MAX) {
+        return -std::numeric_limits<float>::infinity();
+    } else if constexpr (K == Kind::MIN) {
+        return std::numeric_limits<float>::infinity();
+    } else if constexpr (K == Kind::PROD) {
+        return 1.f;
+    } else {
+        return 0.f;
     }
-    return result;
 }
 
-template <typename HalfType>
-float max_half_impl(const HalfType *data, size_t len, ptrdiff_t stride) {
-    float result = utils::cast<float>(data[0]);
-    for (size_t i = 1; i < len; i++) {
-        result = std::max(result, utils::cast<float>(data[i * stride]));
+// 任意步长，或没有向量路径时逐元素累加；COMPENSATED 时做 Kahan 补偿
+template <Kind K, typename T>
+float reduceScalar(const T *data, size_t len, ptrdiff_t stride, bool compensated) {
+    if constexpr (!isSum(K)) {
+        float result = identity<K>();
+        for (size_t i = 0; i < len; i++) {
+            const float val = utils::cast<float>(data[ptrdiff_t(i) * stride]);
+            // std::max/min 只在 NaN 是第一个操作数时返回 NaN，这里任一为 NaN 时都保留 NaN
+            if constexpr (K == Kind::MAX) {
+                result = result > val || result != result ? result : val;
+            } else if constexpr (K == Kind::MIN) {
+                result = result < val || result != result ? result : val;
+            } else {
+                result *= val;
+            }
+        }
+        return result;
+    } else {
+        float result = 0, comp = 0;
+        for (size_t i = 0; i < len; i++) {
+            float val = utils::cast<float>(data[ptrdiff_t(i) * stride]);
+            if constexpr (K == Kind::SUM_SQUARED) {
+                val *= val;
+            }
+            if (compensated) {
+                const float y = val - comp;
+                const float t = result + y;
+                comp = (t - result) - y;
+                result = t;
+            } else {
+                result += val;
+            }
+        }
+        return result;
     }
-    return result;
 }
 
-template <typename HalfType>
-float sumSquared_half_impl(const HalfType *data, size_t len, ptrdiff_t stride) {
-    float result = 0;
-    for (size_t i = 0; i < len; i++) {
-        float val = utils::cast<float>(data[i * stride]);
-        result += val * val;
+#ifdef INFINIOP_CPU_X86_SIMD
+
+using namespace elementwise::cpu::simd;
+
+// 向量累加器个数：隐藏加法的延迟，同时把一行分成多组分别求和，误差也随之减小
+constexpr size_t ACCUMULATORS = 4;
+// 下面在累加器上的循环都完全展开（unroll 与 ACCUMULATORS 一致），累加器才能留在寄存器中
+
+// ------------------------------------------------------------------ AVX2
+
+/**
+ * 合并两个部分结果。max/min 指令在任一操作数为 NaN 时返回第二个操作数，
+ * 因此再把 a 中的 NaN 混合回去，使结果与标量路径一样在任一操作数为 NaN 时为 NaN。
+ */
+template <Kind K>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline __m128 applySse(__m128 a, __m128 b) {
+    if constexpr (K == Kind::MAX) {
+        return _mm_blendv_ps(_mm_max_ps(a, b), a, _mm_cmpunord_ps(a, a));
+    } else if constexpr (K == Kind::MIN) {
+        return _mm_blendv_ps(_mm_min_ps(a, b), a, _mm_cmpunord_ps(a, a));
+    } else if constexpr (K == Kind::PROD) {
+        return _mm_mul_ps(a, b);
+    } else {
+        return _mm_add_ps(a, b);
     }
-    return result;
+}
+
+template <Kind K>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline __m256 applyAvx2(__m256 a, __m256 b) {
+    if constexpr (K == Kind::MAX) {
+        return _mm256_blendv_ps(_mm256_max_ps(a, b), a, _mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+    } else if constexpr (K == Kind::MIN) {
+        return _mm256_blendv_ps(_mm256_min_ps(a, b), a, _mm256_cmp_ps(a, a, _CMP_UNORD_Q));
+    } else if constexpr (K == Kind::PROD) {
+        return _mm256_mul_ps(a, b);
+    } else {
+        return _mm256_add_ps(a, b);
+    }
+}
+
+template <Kind K, bool Compensated>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline void accumulateAvx2(__m256 &acc, __m256 &comp, __m256 val) {
+    if constexpr (!isSum(K)) {
+        acc = applyAvx2<K>(acc, val);
+    } else if constexpr (!Compensated) {
+        acc = K == Kind::SUM_SQUARED ? _mm256_fmadd_ps(val, val, acc) : _mm256_add_ps(acc, val);
+    } else {
+        const __m256 y = K == Kind::SUM_SQUARED ? _mm256_fmsub_ps(val, val, comp) : _mm256_sub_ps(val, comp);
+        const __m256 t = _mm256_add_ps(acc, y);
+        comp = _mm256_sub_ps(_mm256_sub_ps(t, acc), y);
+        acc = t;
+    }
+}
+
+// 合并一个向量的各通道
+template <Kind K>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline float reduceLanesAvx2(__m256 v) {
+    __m128 x = applySse<K>(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    x = applySse<K>(x, _mm_movehl_ps(x, x));
+    return _mm_cvtss_f32(applySse<K>(x, _mm_movehdup_ps(x)));
+}
+
+// 合并各累加器与各通道；补偿求和时在 double 中减去各通道的修正量
+template <Kind K, bool Compensated>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+inline float combineAvx2(const __m256 (&acc)[ACCUMULATORS], const __m256 (&comp)[ACCUMULATORS]) {
+    if constexpr (Compensated) {
+        __m256d result = _mm256_setzero_pd();
+#pragma GCC unroll 4
+        for (size_t u = 0; u < ACCUMULATORS; ++u) {
+            const __m256d lo = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(acc[u])), _mm256_cvtps_pd(_mm256_castps256_ps128(comp[u])));
+            const __m256d hi = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(acc[u], 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(comp[u], 1)));
+            result = _mm256_add_pd(result, _mm256_add_pd(lo, hi));
+        }
+        __m128d x = _mm_add_pd(_mm256_castpd256_pd128(result), _mm256_extractf128_pd(result, 1));
+        x = _mm_add_sd(x, _mm_unpackhi_pd(x, x));
+        return float(_mm_cvtsd_f64(x));
+    } else {
+        __m256 v = acc[0];
+#pragma GCC unroll 4
+        for (size_t u = 1; u < ACCUMULATORS; ++u) {
+            v = applyAvx2<K>(v, acc[u]);
+        }
+        return reduceLanesAvx2<K>(v);
+    }
+}
+
+// 尾部不足一个向量时补上单位元后按整个向量处理
+template <Kind K, bool Compensated, typename T>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX2)
+float reduceAvx2(const T *data, size_t len) {
+    __m256 acc[ACCUMULATORS], comp[ACCUMULATORS];
+#pragma GCC unroll 4
+    for (size_t u = 0; u < ACCUMULATORS; ++u) {
+        acc[u] = _mm256_set1_ps(identity<K>());
+        comp[u] = _mm256_setzero_ps();
+    }
+    size_t i = 0;
+    for (; i + 8 * ACCUMULATORS <= len; i += 8 * ACCUMULATORS) {
+#pragma GCC unroll 4
+        for (size_t u = 0; u < ACCUMULATORS; ++u) {
+            accumulateAvx2<K, Compensated>(acc[u], comp[u], loadAvx2(data + i + u * 8));
+        }
+    }
+    for (; i + 8 <= len; i += 8) {
+        accumulateAvx2<K, Compensated>(acc[0], comp[0], loadAvx2(data + i));
+    }
+    if (i < len) {
+        float tail[8];
+        for (size_t l = 0; l < 8; ++l) {
+            tail[l] = i + l < len ? utils::cast<float>(data[i + l]) : identity<K>();
+        }
+        accumulateAvx2<K, Compensated>(acc[0], comp[0], _mm256_loadu_ps(tail));
+    }
+
+    return combineAvx2<K, Compensated>(acc, comp);
+}
+
+// ---------------------------------------------------------------- AVX-512
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+template <Kind K>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+inline __m512 applyAvx512(__m512 a, __m512 b) {
+    if constexpr (K == Kind::MAX) {
+        return _mm512_mask_mov_ps(_mm512_max_ps(a, b), _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q), a);
+    } else if constexpr (K == Kind::MIN) {
+        return _mm512_mask_mov_ps(_mm512_min_ps(a, b), _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q), a);
+    } else if constexpr (K == Kind::PROD) {
+        return _mm512_mul_ps(a, b);
+    } else {
+        return _mm512_add_ps(a, b);
+    }
+}
+
+template <Kind K, bool Compensated>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+inline void accumulateAvx512(__m512 &acc, __m512 &comp, __m512 val) {
+    if constexpr (!isSum(K)) {
+        acc = applyAvx512<K>(acc, val);
+    } else if constexpr (!Compensated) {
+        acc = K == Kind::SUM_SQUARED ? _mm512_fmadd_ps(val, val, acc) : _mm512_add_ps(acc, val);
+    } else {
+        const __m512 y = K == Kind::SUM_SQUARED ? _mm512_fmsub_ps(val, val, comp) : _mm512_sub_ps(val, comp);
+        const __m512 t = _mm512_add_ps(acc, y);
+        comp = _mm512_sub_ps(_mm512_sub_ps(t, acc), y);
+        acc = t;
+    }
+}
+
+// 与 combineAvx2 相同
+template <Kind K, bool Compensated>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+inline float combineAvx512(const __m512 (&acc)[ACCUMULATORS], const __m512 (&comp)[ACCUMULATORS]) {
+    if constexpr (Compensated) {
+        __m512d result = _mm512_setzero_pd();
+#pragma GCC unroll 4
+        for (size_t u = 0; u < ACCUMULATORS; ++u) {
+            const __m512d lo = _mm512_sub_pd(_mm512_cvtps_pd(_mm512_castps512_ps256(acc[u])), _mm512_cvtps_pd(_mm512_castps512_ps256(comp[u])));
+            const __m512d hi = _mm512_sub_pd(_mm512_cvtps_pd(_mm512_extractf32x8_ps(acc[u], 1)), _mm512_cvtps_pd(_mm512_extractf32x8_ps(comp[u], 1)));
+            result = _mm512_add_pd(result, _mm512_add_pd(lo, hi));
+        }
+        return float(_mm512_reduce_add_pd(result));
+    } else {
+        __m512 v = acc[0];
+#pragma GCC unroll 4
+        for (size_t u = 1; u < ACCUMULATORS; ++u) {
+            v = applyAvx512<K>(v, acc[u]);
+        }
+        // _mm512_reduce_max_ps/min_ps 会丢掉 NaN，两半合并后按 AVX2 的方式合并各通道
+        if constexpr (K == Kind::MAX || K == Kind::MIN) {
+            return reduceLanesAvx2<K>(applyAvx2<K>(_mm512_castps512_ps256(v), _mm512_extractf32x8_ps(v, 1)));
+        } else if constexpr (K == Kind::PROD) {
+            return _mm512_reduce_mul_ps(v);
+        } else {
+            return _mm512_reduce_add_ps(v);
+        }
+    }
+}
+
+// 尾部用掩码加载：求和时无效通道为 0，其余规约不更新无效通道
+template <Kind K, bool Compensated, typename T>
+INFINIOP_CPU_TARGET(INFINIOP_ELEMENTWISE_AVX512)
+float reduceAvx512(const T *data, size_t len) {
+    __m512 acc[ACCUMULATORS], comp[ACCUMULATORS];
+#pragma GCC unroll 4
+    for (size_t u = 0; u < ACCUMULATORS; ++u) {
+        acc[u] = _mm512_set1_ps(identity<K>());
+        comp[u] = _mm512_setzero_ps();
+    }
+    size_t i = 0;
+    for (; i + 16 * ACCUMULATORS <= len; i += 16 * ACCUMULATORS) {
+#pragma GCC unroll 4
+        for (size_t u = 0; u < ACCUMULATORS; ++u) {
+            accumulateAvx512<K, Compensated>(acc[u], comp[u], loadAvx512(data + i + u * 16, __mmask16(0xffff)));
+        }
+    }
+    for (; i < len; i += 16) {
+        const size_t rest = len - i;
+        const __mmask16 mask = rest >= 16 ? __mmask16(0xffff) : __mmask16((1u << rest) - 1);
+        const __m512 val = loadAvx512(data + i, mask);
+        if constexpr (!isSum(K)) {
+            acc[0] = _mm512_mask_mov_ps(acc[0], mask, applyAvx512<K>(acc[0], val));
+        } else {
+            accumulateAvx512<K, Compensated>(acc[0], comp[0], val);
+        }
+    }
+
+    return combineAvx512<K, Compensated>(acc, comp);
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIOP_CPU_X86_SIMD
+
+template <Kind K, bool Compensated, typename T>
+float reduceContiguous(const T *data, size_t len) {
+#ifdef INFINIOP_CPU_X86_SIMD
+    const auto &isa = device::cpu::isa();
+    if (isa.avx512 && isa.f16c) {
+        return reduceAvx512<K, Compensated>(data, len);
+    }
+    if (isa.avx2 && isa.f16c) {
+        return reduceAvx2<K, Compensated>(data, len);
+    }
+#endif
+    return reduceScalar<K>(data, len, 1, Compensated);
+}
+
+template <Kind K, typename T>
+float reduce(const T *data, size_t len, ptrdiff_t stride, Summation summation = Summation::FAST) {
+    const bool compensated = isSum(K) && summation == Summation::COMPENSATED;
+    if (stride != 1) {
+        return reduceScalar<K>(data, len, stride, compensated);
+    }
+    return compensated ? reduceContiguous<K, true>(data, len) : reduceContiguous<K, false>(data, len);
+}
+
+} // namespace
+
+// fp32
+float sum(const float *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM>(data, len, stride, summation);
+}
+
+float max(const float *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::MAX>(data, len, stride);
+}
+
+float min(const float *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::MIN>(data, len, stride);
+}
+
+float prod(const float *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::PROD>(data, len, stride);
+}
+
+float sumSquared(const float *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM_SQUARED>(data, len, stride, summation);
 }
 
 // fp16
-float sum(const fp16_t *data, size_t len, ptrdiff_t stride) {
-    return sum_half_impl(data, len, stride);
+float sum(const fp16_t *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM>(data, len, stride, summation);
 }
 
 float max(const fp16_t *data, size_t len, ptrdiff_t stride) {
-    return max_half_impl(data, len, stride);
+    return reduce<Kind::MAX>(data, len, stride);
+}
+
+float min(const fp16_t *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::MIN>(data, len, stride);
+}
+
+float prod(const fp16_t *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::PROD>(data, len, stride);
 }
 
-float sumSquared(const fp16_t *data, size_t len, ptrdiff_t stride) {
-    return sumSquared_half_impl(data, len, stride);
+float sumSquared(const fp16_t *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM_SQUARED>(data, len, stride, summation);
 }
 
 // bf16
-float sum(const bf16_t *data, size_t len, ptrdiff_t stride) {
-    return sum_half_impl(data, len, stride);
+float sum(const bf16_t *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM>(data, len, stride, summation);
 }
 
 float max(const bf16_t *data, size_t len, ptrdiff_t stride) {
-    return max_half_impl(data, len, stride);
+    return reduce<Kind::MAX>(data, len, stride);
+}
+
+float min(const bf16_t *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::MIN>(data, len, stride);
+}
+
+float prod(const bf16_t *data, size_t len, ptrdiff_t stride) {
+    return reduce<Kind::PROD>(data, len, stride);
 }
 
-float sumSquared(const bf16_t *data, size_t len, ptrdiff_t stride) {
-    return sumSquared_half_impl(data, len, stride);
+float sumSquared(const bf16_t *data, size_t len, ptrdiff_t stride, Summation summation) {
+    return reduce<Kind::SUM_SQUARED>(data, len, stride, summation);
 }
 
 } // namespace op::common_cpu::reduce_op
@@ -13,9 +13,29 @@ namespace op::common_cpu {
 
 namespace reduce_op {
 
+/**
+ * How the fp32/fp16/bf16 overloads of `sum` and `sumSquared` accumulate.
+ *
+ * Contiguous data (`stride == 1`) is reduced with several vector accumulators
+ * and fp16/bf16 is widened a whole vector at a time; the partial sums are
+ * combined at the end. `COMPENSATED` additionally keeps a Kahan correction per
+ * lane, so the error no longer grows with the length of the row; on rows that
+ * fit in cache it is about 4x slower. It relies on the code not being built
+ * with `-ffast-math`, which would reassociate the compensation away.
+ */
+enum class Summation {
+    FAST,
+    COMPENSATED,
+};
+
+/**
+ * `COMPENSATED` if the environment variable `INFINIOP_CPU_COMPENSATED_SUM` is
+ * `1`, `FAST` otherwise; read once.
+ */
+Summation defaultSummation();
+
 template <typename T>
 using ReduceToSame = std::disjunction<
-    std::is_same<T, float>,
     std::is_same<T, double>,
     std::is_same<T, uint8_t>,
     std::is_same<T, int8_t>,
@@ -36,22 +56,55 @@ T sum(const T *data, size_t len, ptrdiff_t stride = 1) {
     return result;
 }
 
-float sum(const fp16_t *data, size_t len, ptrdiff_t stride = 1);
-float sum(const bf16_t *data, size_t len, ptrdiff_t stride = 1);
+float sum(const float *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
+float sum(const fp16_t *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
+float sum(const bf16_t *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
 
 template <typename T, typename = std::enable_if_t<ReduceToSame<T>::value>>
 T max(const T *data, size_t len, ptrdiff_t stride = 1) {
     T result = data[0];
     for (size_t i = 1; i < len; i++) {
-        result = std::max(result, data[i * stride]);
+        const T val = data[i * stride];
+        result = result > val || result != result ? result : val;
     }
 
     return result;
 }
 
+// `max` and `min` return NaN if any element is NaN, like `torch.max` / `torch.min`.
+float max(const float *data, size_t len, ptrdiff_t stride = 1);
 float max(const fp16_t *data, size_t len, ptrdiff_t stride = 1);
 float max(const bf16_t *data, size_t len, ptrdiff_t stride = 1);
 
+template <typename T, typename = std::enable_if_t<ReduceToSame<T>::value>>
+T min(const T *data, size_t len, ptrdiff_t stride = 1) {
+    T result = data[0];
+    for (size_t i = 1; i < len; i++) {
+        const T val = data[i * stride];
+        result = result < val || result != result ? result : val;
+    }
+
+    return result;
+}
+
+float min(const float *data, size_t len, ptrdiff_t stride = 1);
+float min(const fp16_t *data, size_t len, ptrdiff_t stride = 1);
+float min(const bf16_t *data, size_t len, ptrdiff_t stride = 1);
+
+template <typename T, typename = std::enable_if_t<ReduceToSame<T>::value>>
+T prod(const T *data, size_t len, ptrdiff_t stride = 1) {
+    T result = 1;
+    for (size_t i = 0; i < len; i++) {
+        result *= data[i * stride];
+    }
+
+    return result;
+}
+
+float prod(const float *data, size_t len, ptrdiff_t stride = 1);
+float prod(const fp16_t *data, size_t len, ptrdiff_t stride = 1);
+float prod(const bf16_t *data, size_t len, ptrdiff_t stride = 1);
+
 template <typename T, typename = std::enable_if_t<ReduceToSame<T>::value>>
 T sumSquared(const T *data, size_t len, ptrdiff_t stride = 1) {
     T result = 0;
@@ -63,8 +116,9 @@ T sumSquared(const T *data, size_t len, ptrdiff_t stride = 1) {
     return result;
 }
 
-float sumSquared(const fp16_t *data, size_t len, ptrdiff_t stride = 1);
-float sumSquared(const bf16_t *data, size_t len, ptrdiff_t stride = 1);
+float sumSquared(const float *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
+float sumSquared(const fp16_t *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
+float sumSquared(const bf16_t *data, size_t len, ptrdiff_t stride = 1, Summation summation = defaultSummation());
 
 } // namespace reduce_op
 
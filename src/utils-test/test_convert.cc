@@ -0,0 +1,107 @@
+#include "utils_test.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+uint32_t bits(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+float fromBits(uint32_t u) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// fp32 输入：各类边界值（含非规格化数、舍入的中点、inf 与 NaN）之后接随机位模式，
+// 长度不是向量宽度的倍数，使向量主体与尾部都被覆盖
+std::vector<float> f32Inputs() {
+    std::vector<uint32_t> u = {
+        0x00000000, 0x80000000, 0x00000001, 0x80000001, 0x0041f425, 0x807fffff, 0x007fffff, 0x00800000,
+        0x3f800000, 0x3f808000, 0x3f818000, 0x3f80ffff, 0x477fefff, 0x477ff000, 0x7f7fffff, 0xff7fffff,
+        0x33000000, 0x33000001, 0x387fc000, 0x38800000, 0x7f800000, 0xff800000, 0x7fc00000, 0xffc00000,
+        0x7f800001, 0x7fbfffff, 0xff80ffff, 0x7fffffff};
+    std::mt19937 rng(17);
+    while (u.size() < 1037) {
+        u.push_back(rng());
+    }
+    std::vector<float> f(u.size());
+    for (size_t i = 0; i < u.size(); ++i) {
+        f[i] = fromBits(u[i]);
+    }
+    return f;
+}
+
+// 两个结果都是 NaN 时视为相同，NaN 的载荷在不同指令集下可以不同
+bool same(float a, float b) {
+    return bits(a) == bits(b) || (std::isnan(a) && std::isnan(b));
+}
+
+template <typename Half>
+int checkNarrow(const char *name, bool (*eq)(Half, Half)) {
+    const auto src = f32Inputs();
+    std::vector<Half> got(src.size()), ref(src.size());
+    utils::convert_n(src.data(), src.size(), got.data());
+    int fails = 0;
+    for (size_t i = 0; i < src.size(); ++i) {
+        ref[i] = utils::cast<Half>(src[i]);
+        if (!eq(got[i], ref[i])) {
+            if (fails++ < 10) {
+                std::cerr << name << ": input 0x" << std::hex << bits(src[i]) << " gives 0x" << got[i]._v
+                          << ", expected 0x" << ref[i]._v << std::dec << std::endl;
+            }
+        }
+    }
+    return fails;
+}
+
+template <typename Half>
+int checkWiden(const char *name) {
+    // 所有 16 位模式
+    std::vector<Half> src(1 << 16);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i]._v = uint16_t(i);
+    }
+    std::vector<float> got(src.size());
+    utils::convert_n(src.data(), src.size(), got.data());
+    int fails = 0;
+    for (size_t i = 0; i < src.size(); ++i) {
+        const float ref = utils::cast<float>(src[i]);
+        if (!same(got[i], ref)) {
+            if (fails++ < 10) {
+                std::cerr << name << ": input 0x" << std::hex << i << " gives 0x" << bits(got[i])
+                          << ", expected 0x" << bits(ref) << std::dec << std::endl;
+            }
+        }
+    }
+    return fails;
+}
+
+bool sameF16(fp16_t a, fp16_t b) {
+    return same(utils::cast<float>(a), utils::cast<float>(b));
+}
+
+bool sameBf16(bf16_t a, bf16_t b) {
+    return a._v == b._v;
+}
+
+int report(const char *name, int fails) {
+    std::cout << "test_convert " << name << (fails ? " failed" : " passed") << std::endl;
+    return fails ? 1 : 0;
+}
+
+} // namespace
+
+// convert_n 的指令集路径（由 INFINIOP_CPU_MAX_ISA 限制）应与逐元素的 cast 逐位一致
+int test_convert() {
+    return report("f16->f32", checkWiden<fp16_t>("f16->f32"))
+         + report("bf16->f32", checkWiden<bf16_t>("bf16->f32"))
+         + report("f32->f16", checkNarrow<fp16_t>("f32->f16", sameF16))
+         + report("f32->bf16", checkNarrow<bf16_t>("f32->bf16", sameBf16));
+}
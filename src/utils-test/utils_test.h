@@ -3,5 +3,6 @@
 #include "../utils.h"
 
 int test_rearrange();
+int test_convert();
 
 #endif
@@ -1,85 +1,208 @@
 #include "custom_types.h"
-#include <cstdint>
+#include "simd_diagnostic.h"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+#define INFINIUTILS_X86_SIMD
+#include <cstdlib>
 #include <cstring>
+#include <immintrin.h>
+#endif
+
+namespace utils {
+
+namespace {
+
+template <typename TypeFrom, typename TypeTo>
+void convertScalar(const TypeFrom *src, size_t n, TypeTo *dst) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = cast<TypeTo>(src[i]);
+    }
+}
+
+#ifdef INFINIUTILS_X86_SIMD
+
+// 与 infiniop 的 device::cpu::isa() 相同的分级，utils 不依赖 infiniop，这里单独检测
+struct Isa {
+    // AVX2 + FMA + F16C
+    bool avx2;
+    // AVX-512 F/BW/VL
+    bool avx512;
+};
+
+Isa detect() {
+    __builtin_cpu_init();
+    Isa isa{};
+    isa.avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c");
+    isa.avx512 = isa.avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl");
+
+    const char *limit = std::getenv("INFINIOP_CPU_MAX_ISA");
+    if (limit == nullptr) {
+        return isa;
+    }
+    if (std::strcmp(limit, "scalar") == 0) {
+        isa = Isa{};
+    } else if (std::strcmp(limit, "avx2") == 0 || std::strcmp(limit, "avxvnni") == 0) {
+        isa.avx512 = false;
+    }
+    return isa;
+}
+
+const Isa &isa() {
+    static const Isa info = detect();
+    return info;
+}
+
+#define INFINIUTILS_AVX2 "avx2,fma,f16c"
+#define INFINIUTILS_AVX512 "avx512f,avx512bw,avx512vl,avx2,fma,f16c"
+
+// ------------------------------------------------------------------ AVX2
 
-float _f16_to_f32(fp16_t val) {
-    uint16_t h = val._v;
-    uint32_t sign = (h & 0x8000) << 16;
-    int32_t exponent = (h >> 10) & 0x1F;
-    uint32_t mantissa = h & 0x3FF;
-
-    uint32_t f32;
-    if (exponent == 31) {
-        if (mantissa != 0) {
-            f32 = sign | 0x7F800000 | (mantissa << 13);
-        } else {
-            f32 = sign | 0x7F800000;
-        }
-    } else if (exponent == 0) {
-        if (mantissa == 0) {
-            f32 = sign;
-        } else {
-            exponent = -14;
-            while ((mantissa & 0x400) == 0) {
-                mantissa <<= 1;
-                exponent--;
-            }
-            mantissa &= 0x3FF;
-            f32 = sign | ((exponent + 127) << 23) | (mantissa << 13);
-        }
-    } else {
-        f32 = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
-    }
-
-    float result;
-    memcpy(&result, &f32, sizeof(result));
-    return result;
-}
-
-fp16_t _f32_to_f16(float val) {
-    uint32_t f32;
-    memcpy(&f32, &val, sizeof(f32));               // Read the bits of the float32
-    uint16_t sign = (f32 >> 16) & 0x8000;          // Extract the sign bit
-    int32_t exponent = ((f32 >> 23) & 0xFF) - 127; // Extract and de-bias the exponent
-    uint32_t mantissa = f32 & 0x7FFFFF;            // Extract the mantissa (fraction part)
-
-    if (exponent >= 16) { // Special cases for Inf and NaN
-        // NaN
-        if (exponent == 128 && mantissa != 0) {
-            return fp16_t{static_cast<uint16_t>(sign | 0x7E00)};
-        }
-        // Infinity
-        return fp16_t{static_cast<uint16_t>(sign | 0x7C00)};
-    } else if (exponent >= -14) { // Normalized case
-        return fp16_t{(uint16_t)(sign | ((exponent + 15) << 10) | (mantissa >> 13))};
-    } else if (exponent >= -24) {
-        mantissa |= 0x800000; // Add implicit leading 1
-        mantissa >>= (-14 - exponent);
-        return fp16_t{(uint16_t)(sign | (mantissa >> 13))};
-    } else {
-        // Too small for subnormal: return signed zero
-        return fp16_t{(uint16_t)sign};
-    }
-}
-
-float _bf16_to_f32(bf16_t val) {
-    // 只需把 bf16 放到 float32 高 16 bit，其余 16 位置 0。
-    uint32_t bits32 = static_cast<uint32_t>(val._v) << 16;
-
-    float out;
-    std::memcpy(&out, &bits32, sizeof(out));
-    return out;
-}
-
-bf16_t _f32_to_bf16(float val) {
-    uint32_t bits32;
-    std::memcpy(&bits32, &val, sizeof(bits32));
-
-    // 截断前先加 0x7FFF，再根据第 16 位（有效位的最低位）的奇偶做 round-to-nearest-even
-    const uint32_t rounding_bias = 0x00007FFF +          // 0111 1111 1111 1111
-                                   ((bits32 >> 16) & 1); // 尾数的有效位的最低位奇数时 +1，即实现舍入偶数
-
-    uint16_t bf16_bits = static_cast<uint16_t>((bits32 + rounding_bias) >> 16);
-
-    return bf16_t{bf16_bits};
+__attribute__((target(INFINIUTILS_AVX2))) void f16ToF32Avx2(const fp16_t *src, size_t n, float *dst) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i < n; ++i) {
+        dst[i] = _cvtsh_ss(src[i]._v);
+    }
+}
+
+__attribute__((target(INFINIUTILS_AVX2))) void f32ToF16Avx2(const float *src, size_t n, fp16_t *dst) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), h);
+    }
+    for (; i < n; ++i) {
+        dst[i]._v = _cvtss_sh(src[i], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+}
+
+__attribute__((target(INFINIUTILS_AVX2))) void bf16ToF32Avx2(const bf16_t *src, size_t n, float *dst) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16)));
+    }
+    convertScalar(src + i, n - i, dst + i);
 }
+
+// 与 _f32_to_bf16 相同的舍入，NaN 置静默位而不是进位
+__attribute__((target(INFINIUTILS_AVX2))) __m256i roundBf16Avx2(__m256i x) {
+    const __m256i rounded = _mm256_add_epi32(x, _mm256_add_epi32(_mm256_set1_epi32(0x7fff), _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1))));
+    const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, _mm256_or_si256(x, _mm256_set1_epi32(0x00400000)), nan), 16);
+}
+
+__attribute__((target(INFINIUTILS_AVX2))) void f32ToBf16Avx2(const float *src, size_t n, bf16_t *dst) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i lo = roundBf16Avx2(_mm256_castps_si256(_mm256_loadu_ps(src + i)));
+        __m256i hi = roundBf16Avx2(_mm256_castps_si256(_mm256_loadu_ps(src + i + 8)));
+        // packus 按 128 位通道交错，重新排列为原始顺序
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xd8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), packed);
+    }
+    convertScalar(src + i, n - i, dst + i);
+}
+
+// ---------------------------------------------------------------- AVX-512
+
+INFINIUTILS_AVX512_WARNINGS_PUSH
+
+// 尾部用掩码加载与存储
+inline __mmask16 tailMask(size_t rest) {
+    return __mmask16(rest >= 16 ? 0xffffu : (1u << rest) - 1);
+}
+
+__attribute__((target(INFINIUTILS_AVX512))) void f16ToF32Avx512(const fp16_t *src, size_t n, float *dst) {
+    for (size_t i = 0; i < n; i += 16) {
+        const __mmask16 mask = tailMask(n - i);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(mask, src + i)));
+    }
+}
+
+__attribute__((target(INFINIUTILS_AVX512))) void f32ToF16Avx512(const float *src, size_t n, fp16_t *dst) {
+    for (size_t i = 0; i < n; i += 16) {
+        const __mmask16 mask = tailMask(n - i);
+        __m256i h = _mm512_cvtps_ph(_mm512_maskz_loadu_ps(mask, src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_mask_storeu_epi16(dst + i, mask, h);
+    }
+}
+
+__attribute__((target(INFINIUTILS_AVX512))) void bf16ToF32Avx512(const bf16_t *src, size_t n, float *dst) {
+    for (size_t i = 0; i < n; i += 16) {
+        const __mmask16 mask = tailMask(n - i);
+        __m512i w = _mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(mask, src + i)), 16);
+        _mm512_mask_storeu_ps(dst + i, mask, _mm512_castsi512_ps(w));
+    }
+}
+
+// 不用 AVX512_BF16 的 vcvtneps2bf16：它把 fp32 非规格化数冲为零，结果会因机器而异
+__attribute__((target(INFINIUTILS_AVX512))) void f32ToBf16Avx512(const float *src, size_t n, bf16_t *dst) {
+    for (size_t i = 0; i < n; i += 16) {
+        const __mmask16 mask = tailMask(n - i);
+        __m512i x = _mm512_castps_si512(_mm512_maskz_loadu_ps(mask, src + i));
+        __m512i rounded = _mm512_add_epi32(x, _mm512_add_epi32(_mm512_set1_epi32(0x7fff), _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1))));
+        const __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(x, _mm512_set1_epi32(0x7fffffff)), _mm512_set1_epi32(0x7f800000));
+        rounded = _mm512_mask_mov_epi32(rounded, nan, _mm512_or_si512(x, _mm512_set1_epi32(0x00400000)));
+        _mm256_mask_storeu_epi16(dst + i, mask, _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+    }
+}
+
+INFINIUTILS_AVX512_WARNINGS_POP
+
+#endif // INFINIUTILS_X86_SIMD
+
+} // namespace
+
+void convert_n(const fp16_t *src, size_t n, float *dst) {
+#ifdef INFINIUTILS_X86_SIMD
+    if (isa().avx512) {
+        return f16ToF32Avx512(src, n, dst);
+    }
+    if (isa().avx2) {
+        return f16ToF32Avx2(src, n, dst);
+    }
+#endif
+    convertScalar(src, n, dst);
+}
+
+void convert_n(const float *src, size_t n, fp16_t *dst) {
+#ifdef INFINIUTILS_X86_SIMD
+    if (isa().avx512) {
+        return f32ToF16Avx512(src, n, dst);
+    }
+    if (isa().avx2) {
+        return f32ToF16Avx2(src, n, dst);
+    }
+#endif
+    convertScalar(src, n, dst);
+}
+
+void convert_n(const bf16_t *src, size_t n, float *dst) {
+#ifdef INFINIUTILS_X86_SIMD
+    if (isa().avx512) {
+        return bf16ToF32Avx512(src, n, dst);
+    }
+    if (isa().avx2) {
+        return bf16ToF32Avx2(src, n, dst);
+    }
+#endif
+    convertScalar(src, n, dst);
+}
+
+void convert_n(const float *src, size_t n, bf16_t *dst) {
+#ifdef INFINIUTILS_X86_SIMD
+    if (isa().avx512) {
+        return f32ToBf16Avx512(src, n, dst);
+    }
+    if (isa().avx2) {
+        return f32ToBf16Avx2(src, n, dst);
+    }
+#endif
+    convertScalar(src, n, dst);
+}
+
+} // namespace utils
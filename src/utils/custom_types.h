@@ -1,6 +1,8 @@
 #ifndef __INFINIUTILS_CUSTOM_TYPES_H__
 #define __INFINIUTILS_CUSTOM_TYPES_H__
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <type_traits>
 
 struct CustomFloat16 {
@@ -13,11 +15,78 @@ struct CustomBFloat16 {
 };
 typedef struct CustomBFloat16 bf16_t;
 
-float _f16_to_f32(fp16_t val);
-fp16_t _f32_to_f16(float val);
+/*
+ * Scalar conversions are inline and branch-free so that per-element casts in
+ * kernels compile down to a few integer and fp32 instructions instead of a call.
+ * This header is also included by device compilers, so it uses no intrinsics;
+ * the vectorized paths live in the bulk `utils::convert_n` below.
+ */
 
-float _bf16_to_f32(bf16_t val);
-bf16_t _f32_to_bf16(float val);
+namespace utils::detail {
+
+inline uint32_t f32Bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float f32FromBits(uint32_t u) {
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+} // namespace utils::detail
+
+inline float _f16_to_f32(fp16_t val) {
+    using namespace utils::detail;
+    // 去掉符号位后左移，使 fp16 的指数与尾数对齐到 fp32 的高位
+    const uint32_t w = uint32_t(val._v) << 16;
+    const uint32_t sign = w & 0x80000000u;
+    const uint32_t two_w = w + w;
+    // 规格化数（以及 inf/NaN）：调整指数偏置，再乘 2^-112 把 fp16 的最大指数映射到 fp32 的最大指数
+    const float normalized = f32FromBits((two_w >> 4) + (0xE0u << 23)) * 0x1.0p-112f;
+    // 非规格化数：尾数放入 0.5 的低位后减去 0.5，由浮点减法完成规格化
+    const float denormalized = f32FromBits((two_w >> 17) | (126u << 23)) - 0.5f;
+    // 用整数掩码选择而不是条件表达式，使两个分支都无条件计算，循环可以被自动向量化
+    const uint32_t mask = 0u - uint32_t(two_w < (1u << 27));
+    return f32FromBits(sign | (f32Bits(denormalized) & mask) | (f32Bits(normalized) & ~mask));
+}
+
+inline fp16_t _f32_to_f16(float val) {
+    using namespace utils::detail;
+    const uint32_t w = f32Bits(val);
+    const uint32_t shl1_w = w + w;
+    const uint32_t sign = w & 0x80000000u;
+    // 先乘 2^112 使超出 fp16 范围的值溢出为 inf，再乘 2^-110 恢复量级
+    float base = (f32FromBits(w & 0x7fffffffu) * 0x1.0p+112f) * 0x1.0p-110f;
+    // 加上一个指数合适的 2 的幂，使浮点加法按最近偶数舍入到 fp16 的尾数精度（含非规格化数）
+    uint32_t bias = shl1_w & 0xFF000000u;
+    bias = bias < 0x71000000u ? 0x71000000u : bias;
+    base = f32FromBits((bias >> 1) + 0x07800000u) + base;
+    const uint32_t bits = f32Bits(base);
+    const uint32_t nonsign = ((bits >> 13) & 0x7C00u) + (bits & 0x0FFFu);
+    // NaN 返回静默 NaN
+    const uint32_t nan = 0u - uint32_t(shl1_w > 0xFF000000u);
+    return fp16_t{uint16_t((sign >> 16) | (0x7E00u & nan) | (nonsign & ~nan))};
+}
+
+inline float _bf16_to_f32(bf16_t val) {
+    // 只需把 bf16 放到 float32 高 16 bit，其余 16 位置 0。
+    return utils::detail::f32FromBits(uint32_t(val._v) << 16);
+}
+
+inline bf16_t _f32_to_bf16(float val) {
+    const uint32_t bits32 = utils::detail::f32Bits(val);
+
+    // 截断前先加 0x7FFF，再根据第 16 位（有效位的最低位）的奇偶做 round-to-nearest-even
+    const uint32_t rounding_bias = 0x00007FFF +          // 0111 1111 1111 1111
+                                   ((bits32 >> 16) & 1); // 尾数的有效位的最低位奇数时 +1，即实现舍入偶数
+
+    // NaN 直接截断会进位成 inf，改为返回静默 NaN
+    const bool nan = (bits32 & 0x7FFFFFFFu) > 0x7F800000u;
+    return bf16_t{uint16_t(nan ? (bits32 >> 16) | 0x0040u : (bits32 + rounding_bias) >> 16)};
+}
 
 namespace utils {
 // General template for non-fp16_t conversions
@@ -25,6 +94,10 @@ template <typename TypeTo, typename TypeFrom>
 TypeTo cast(TypeFrom val) {
     if constexpr (std::is_same<TypeTo, TypeFrom>::value) {
         return val;
+    } else if constexpr (std::is_same<TypeTo, fp16_t>::value && std::is_same<TypeFrom, bf16_t>::value) {
+        return _f32_to_f16(_bf16_to_f32(val));
+    } else if constexpr (std::is_same<TypeTo, bf16_t>::value && std::is_same<TypeFrom, fp16_t>::value) {
+        return _f32_to_bf16(_f16_to_f32(val));
     } else if constexpr (std::is_same<TypeTo, fp16_t>::value && std::is_same<TypeFrom, float>::value) {
         return _f32_to_f16(val);
     } else if constexpr (std::is_same<TypeTo, fp16_t>::value && !std::is_same<TypeFrom, float>::value) {
@@ -46,6 +119,24 @@ TypeTo cast(TypeFrom val) {
     }
 }
 
+/**
+ * Converts `n` contiguous elements, like `std::copy_n` with `cast` applied to
+ * each. The fp16/bf16 <-> fp32 overloads pick an F16C, AVX2 or AVX-512 path at
+ * run time on x86 (capped by `INFINIOP_CPU_MAX_ISA` as for the CPU kernels);
+ * fp32 -> fp16/bf16 rounds to nearest even on every path.
+ */
+template <typename TypeFrom, typename TypeTo>
+void convert_n(const TypeFrom *src, size_t n, TypeTo *dst) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = cast<TypeTo>(src[i]);
+    }
+}
+
+void convert_n(const fp16_t *src, size_t n, float *dst);
+void convert_n(const float *src, size_t n, fp16_t *dst);
+void convert_n(const bf16_t *src, size_t n, float *dst);
+void convert_n(const float *src, size_t n, bf16_t *dst);
+
 } // namespace utils
 
 #endif
@@ -0,0 +1,18 @@
+#ifndef INFINIUTILS_SIMD_DIAGNOSTIC_H
+#define INFINIUTILS_SIMD_DIAGNOSTIC_H
+
+// GCC 12 的 AVX-512 intrinsics 头文件用自初始化的未定义向量作为直通操作数，
+// 内联后会误报 -Wuninitialized / -Wmaybe-uninitialized；使用 AVX-512 intrinsics 的代码段
+// 放在这一对宏之间
+#if defined(__GNUC__) && !defined(__clang__)
+#define INFINIUTILS_AVX512_WARNINGS_PUSH                  \
+    _Pragma("GCC diagnostic push")                        \
+    _Pragma("GCC diagnostic ignored \"-Wuninitialized\"") \
+    _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define INFINIUTILS_AVX512_WARNINGS_POP _Pragma("GCC diagnostic pop")
+#else
+#define INFINIUTILS_AVX512_WARNINGS_PUSH
+#define INFINIUTILS_AVX512_WARNINGS_POP
+#endif
+
+#endif // INFINIUTILS_SIMD_DIAGNOSTIC_H
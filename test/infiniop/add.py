@@ -35,6 +35,8 @@ _TEST_CASES_ = [
     ((16, 5632), (13312, 1), (13312, 1), (13312, 1)),
     ((4, 4, 5632), None, None, None),
     ((4, 4, 5632), (45056, 5632, 1), (45056, 5632, 1), (45056, 5632, 1)),
+    ((16, 5632), None, (0, 1), None),
+    ((16, 5632), (0, 0), None, None),
 ]
 
 
@@ -0,0 +1,182 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, y_stride, x_stride, inplace (residual_out is residual)
+    ((1, 4), None, None, False),
+    ((16, 2048), None, None, False),
+    ((16, 2048), None, None, True),
+    ((16, 2048), (4096, 1), (4096, 1), False),
+    ((5, 513), (1000, 1), None, True),
+]
+
+# w (weight) types
+# Note: 'None' means the same as input dtype
+_WEIGHT_DTYPES = [None, InfiniDtype.F32]
+# x types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Form the test cases by appending each element of _WEIGHT_DTYPES to each tuple in _TEST_CASES_
+_TEST_CASES = [
+    test_case + (w_dtype,) for test_case in _TEST_CASES_ for w_dtype in _WEIGHT_DTYPES
+]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 2e-3, "rtol": 2e-3},
+    InfiniDtype.BF16: {"atol": 8e-3, "rtol": 8e-3},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-5},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def add_rms_norm(x, residual, w, eps):
+    # 先按输入类型相加并舍入，再对舍入后的结果做 RMSNorm
+    h = x + residual
+    hf = h.float()
+    rms = torch.rsqrt(hf.pow(2).mean(dim=-1, keepdim=True) + eps)
+    return (hf * rms * w.float()).to(x.dtype), h
+
+
+def test(
+    handle,
+    device,
+    shape,
+    y_stride,
+    x_stride,
+    inplace,
+    w_dtype=InfiniDtype.F32,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # 融合的 AddRMSNorm 目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    w_dtype = w_dtype if w_dtype else dtype
+    print(
+        f"Testing AddRMSNorm on {InfiniDeviceNames[device]} with shape:{shape} y_stride:{y_stride} x_stride:{x_stride}"
+        f" inplace:{inplace} w_dtype:{InfiniDtypeNames[w_dtype]} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    y = TestTensor(shape, y_stride, dtype, device, mode="ones")
+    x = TestTensor(shape, x_stride, dtype, device)
+    residual = TestTensor(shape, None, dtype, device)
+    residual_out = (
+        residual
+        if inplace
+        else TestTensor(shape, None, dtype, device, mode="zeros")
+    )
+    w = TestTensor(shape[-1:], None, w_dtype, device)
+
+    eps = 1e-6
+    ans, ans_residual = add_rms_norm(
+        x.torch_tensor(), residual.torch_tensor(), w.torch_tensor(), eps
+    )
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateAddRMSNormDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            residual_out.descriptor,
+            x.descriptor,
+            residual.descriptor,
+            w.descriptor,
+            eps,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in {id(t): t for t in [x, y, residual, residual_out, w]}.values():
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetAddRMSNormWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, y.device)
+
+    def lib_add_rms_norm():
+        check_error(
+            LIBINFINIOP.infiniopAddRMSNorm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                residual_out.data(),
+                x.data(),
+                residual.data(),
+                w.data(),
+                None,
+            )
+        )
+
+    lib_add_rms_norm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(residual_out.actual_tensor(), ans_residual, atol=atol, rtol=rtol)
+        debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    assert torch.allclose(
+        residual_out.actual_tensor(), ans_residual, atol=atol, rtol=rtol
+    )
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # 原地模式下重复执行会不断累加 residual，性能测试只在非原地时进行
+        if not inplace:
+            # fmt: off
+            profile_operation("PyTorch", lambda: add_rms_norm(x.torch_tensor(), residual.torch_tensor(), w.torch_tensor(), eps), device, NUM_PRERUN, NUM_ITERATIONS)
+            profile_operation("    lib", lambda: lib_add_rms_norm(), device, NUM_PRERUN, NUM_ITERATIONS)
+            # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyAddRMSNormDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
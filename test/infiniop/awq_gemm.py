@@ -0,0 +1,200 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # m, n, k, group_size, a_stride
+    (1, 4096, 4096, 128, None),
+    (7, 264, 256, 128, None),
+    (37, 1040, 384, 64, None),
+    (3, 8, 64, 32, (1, 3)),
+]
+
+# 缩放因子数据类型
+_SCALE_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+_TEST_CASES = [
+    test_case + (scale_dtype,)
+    for test_case in _TEST_CASES_
+    for scale_dtype in _SCALE_DTYPES
+]
+
+# Data types of a and c used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-4, "rtol": 1e-4},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def awq_dequantize_pytorch(qweight, zeros, scales, group_size):
+    """PyTorch 实现的 AWQ 反量化参考实现，结果为 float64"""
+    bits = 4
+    shifts = torch.arange(0, 32, bits, device=qweight.device)
+    AWQ_REVERSE_ORDER = [0, 4, 1, 5, 2, 6, 3, 7]
+
+    def unpack(packed):
+        t = torch.bitwise_right_shift(packed[:, :, None], shifts[None, None, :])
+        t = t.view(packed.shape[0], -1)
+        order = torch.arange(t.shape[-1], device=t.device).view(-1, 32 // bits)
+        return t[:, order[:, AWQ_REVERSE_ORDER].reshape(-1)] & 0xF
+
+    iweights = unpack(qweight)
+    izeros = unpack(zeros).repeat_interleave(group_size, dim=0)
+    scales = scales.double().repeat_interleave(group_size, dim=0)
+    return (iweights - izeros).double() * scales
+
+
+def awq_gemm(c, a, qweight, zeros, scales, group_size):
+    w = awq_dequantize_pytorch(qweight, zeros, scales, group_size)
+    c.copy_(torch.matmul(a.double(), w))
+
+
+def test(
+    handle,
+    device,
+    m,
+    n,
+    k,
+    group_size,
+    a_stride=None,
+    scale_dtype=InfiniDtype.F16,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # W4A16 矩阵乘目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing AWQGemm on {InfiniDeviceNames[device]} with m:{m} n:{n} k:{k}"
+        f" group_size:{group_size} a_stride:{a_stride}"
+        f" scale_dtype:{InfiniDtypeNames[scale_dtype]} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    groups = k // group_size
+    a = TestTensor((m, k), a_stride, dtype, device)
+    qweight = TestTensor((k, n // 8), None, InfiniDtype.I32, device, mode="random")
+    zeros = TestTensor((groups, n // 8), None, InfiniDtype.I32, device, mode="random")
+    scales = TestTensor((groups, n), None, scale_dtype, device, scale=0.01)
+    c = TestTensor((m, n), None, dtype, device, mode="zeros")
+    ans = TestTensor((m, n), None, dtype, device, mode="zeros")
+
+    def torch_awq_gemm():
+        awq_gemm(
+            ans.torch_tensor(),
+            a.torch_tensor(),
+            qweight.torch_tensor(),
+            zeros.torch_tensor(),
+            scales.torch_tensor(),
+            group_size,
+        )
+
+    torch_awq_gemm()
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateAWQGemmDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            c.descriptor,
+            a.descriptor,
+            qweight.descriptor,
+            zeros.descriptor,
+            scales.descriptor,
+            group_size,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [a, qweight, zeros, scales, c]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetAWQGemmWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_awq_gemm():
+        check_error(
+            LIBINFINIOP.infiniopAWQGemm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c.data(),
+                a.data(),
+                qweight.data(),
+                zeros.data(),
+                scales.data(),
+                None,
+            )
+        )
+
+    lib_awq_gemm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+    assert torch.allclose(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch_awq_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_awq_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyAWQGemmDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -0,0 +1,156 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    profile_operation,
+    to_torch_dtype,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, x_stride, y_stride
+    ((13,), None, None),
+    ((4096,), None, None),
+    ((16, 2048), None, None),
+    ((16, 2048), (4096, 1), (4096, 1)),
+    ((13, 4), (10, 1), (1, 13)),
+    ((4, 5, 6), (1, 4, 20), None),
+    ((3, 7, 257), (2048, 257, 1), (1799, 257, 1)),
+]
+
+# y types
+_OUTPUT_DTYPES = [
+    InfiniDtype.F16,
+    InfiniDtype.BF16,
+    InfiniDtype.F32,
+    InfiniDtype.F64,
+    InfiniDtype.I8,
+    InfiniDtype.I32,
+    InfiniDtype.I64,
+]
+# x types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32, InfiniDtype.I32]
+
+# Form the test cases by appending each element of _OUTPUT_DTYPES to each tuple in _TEST_CASES_
+_TEST_CASES = [
+    test_case + (y_dtype,) for test_case in _TEST_CASES_ for y_dtype in _OUTPUT_DTYPES
+]
+
+_INTEGER_DTYPES = [InfiniDtype.I8, InfiniDtype.I32, InfiniDtype.I64]
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def test(
+    handle,
+    device,
+    shape,
+    x_stride,
+    y_stride,
+    y_dtype=InfiniDtype.F16,
+    dtype=InfiniDtype.F32,
+    sync=None,
+):
+    # Cast 目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing Cast on {InfiniDeviceNames[device]} with shape:{shape} x_stride:{x_stride} y_stride:{y_stride}"
+        f" x_dtype:{InfiniDtypeNames[dtype]} y_dtype:{InfiniDtypeNames[y_dtype]}"
+    )
+
+    # Values stay within the range of every tested output type, so the results are exact
+    if dtype in _INTEGER_DTYPES:
+        values = torch.randint(-100, 100, shape, dtype=torch.int32)
+    else:
+        values = torch.rand(shape) * 200 - 100
+    if x_stride is not None:
+        values = torch.empty_strided(shape, x_stride).copy_(values)
+    x = TestTensor(shape, x_stride, dtype, device, mode="manual", set_tensor=values)
+    y = TestTensor(shape, y_stride, y_dtype, device, mode="zeros")
+
+    ans = x.torch_tensor().to(to_torch_dtype(y_dtype))
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateCastDescriptor(
+            handle, ctypes.byref(descriptor), y.descriptor, x.descriptor
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [x, y]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetCastWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, y.device)
+
+    def lib_cast():
+        check_error(
+            LIBINFINIOP.infiniopCast(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                None,
+            )
+        )
+
+    lib_cast()
+
+    if DEBUG:
+        debug(y.actual_tensor(), ans, atol=0, rtol=0)
+    assert torch.equal(y.actual_tensor(), ans)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: x.torch_tensor().to(to_torch_dtype(y_dtype)), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_cast(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyCastDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -15,6 +15,7 @@ from libinfiniop import (
     InfiniDtype,
     InfiniDtypeNames,
     InfiniDeviceNames,
+    InfiniDeviceEnum,
     infiniopOperatorDescriptor_t,
 )
 from enum import Enum, auto
@@ -32,6 +33,13 @@ _TEST_CASES_ = [
     ((32, 20, 512), None, None),
     ((32, 20, 512), (20480, 512, 1), None),
     ((28, 15, 15), None, None),
+    ((4, 3000), None, None),
+    ((1, 1, 20000), None, None),
+]
+
+# Non-unit stride along the softmax dimension: only the CPU kernel supports it
+_CPU_TEST_CASES_ = [
+    ((2, 3, 2100), (12600, 4200, 2), None),
 ]
 
 # Data types used for testing
@@ -61,6 +69,12 @@ _TEST_CASES = [
     for inplace_item in _INPLACE
 ]
 
+_CPU_TEST_CASES = [
+    test_case + (inplace_item,)
+    for test_case in _CPU_TEST_CASES_
+    for inplace_item in _INPLACE
+]
+
 DEBUG = False
 PROFILE = False
 NUM_PRERUN = 10
@@ -161,5 +175,7 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        if device == InfiniDeviceEnum.CPU:
+            test_operator(device, test, _CPU_TEST_CASES, _TENSOR_DTYPES)
 
     print("\033[92mTest passed!\033[0m")
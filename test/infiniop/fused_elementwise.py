@@ -0,0 +1,196 @@
+import torch
+import ctypes
+from ctypes import c_uint64, c_void_p
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+    infiniopTensorDescriptor_t,
+    infiniopElementwiseNode_t,
+)
+
+# infiniopElementwiseOp_t
+ADD, SUB, MUL, RELU, CLIP, SWIGLU = range(6)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+
+# 表达式：输入个数、节点列表（算子与操作数，操作数 >= 输入个数时引用之前的节点）与 torch 参考实现
+_EXPRESSIONS = {
+    # clip(a * b + c, lo, hi)
+    "clip_mul_add": (
+        5,
+        [(MUL, (0, 1)), (ADD, (5, 2)), (CLIP, (6, 3, 4))],
+        lambda a, b, c, lo, hi: torch.max(torch.min(a * b + c, hi), lo),
+    ),
+    # relu(x + residual)
+    "relu_add": (
+        2,
+        [(ADD, (0, 1)), (RELU, (2,))],
+        lambda x, r: torch.relu(x + r),
+    ),
+    # swiglu(up - bias, gate) * scale
+    "swiglu_sub_mul": (
+        4,
+        [(SUB, (0, 2)), (SWIGLU, (4, 1)), (MUL, (5, 3))],
+        lambda up, gate, bias, scale: (up - bias)
+        * gate
+        * torch.sigmoid(gate)
+        * scale,
+    ),
+}
+
+_TEST_CASES_ = [
+    # shape, strides of every input (None means contiguous, a stride of 0 broadcasts), y_stride
+    ((13, 4), None, None),
+    ((13, 4), [(0, 1), (1, 0), (0, 0), None, None], (10, 1)),
+    ((13, 4, 4), [(20, 4, 1), (4, 0, 1), None, (0, 4, 1), None], None),
+    ((16, 5632), None, None),
+    ((16, 5632), [None, (0, 1), (1, 0), (0, 0), (0, 0)], None),
+    ((4, 4, 5632), None, (45056, 5632, 1)),
+]
+
+_TEST_CASES = [
+    test_case + (expression,)
+    for test_case in _TEST_CASES_
+    for expression in _EXPRESSIONS
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-3},
+    InfiniDtype.F32: {"atol": 1e-6, "rtol": 1e-6},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 1e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def test(
+    handle,
+    device,
+    shape,
+    x_strides,
+    y_stride,
+    expression,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # 融合的逐元素算子目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    input_count, nodes, reference = _EXPRESSIONS[expression]
+    if x_strides is None:
+        x_strides = [None] * input_count
+
+    print(
+        f"Testing FusedElementwise on {InfiniDeviceNames[device]} with expression:{expression} shape:{shape} "
+        f"x_strides:{x_strides[:input_count]} y_stride:{y_stride} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    x = [TestTensor(shape, x_strides[i], dtype, device) for i in range(input_count)]
+    y = TestTensor(shape, y_stride, dtype, device, mode="zeros")
+    # 参考结果在 fp32 中计算，与库的计算精度一致
+    ans = reference(*[t.torch_tensor().float() for t in x]).to(y.torch_tensor().dtype)
+
+    if sync is not None:
+        sync()
+
+    c_nodes = (infiniopElementwiseNode_t * len(nodes))()
+    for k, (op, operands) in enumerate(nodes):
+        c_nodes[k].op = op
+        for i, operand in enumerate(operands):
+            c_nodes[k].operands[i] = operand
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateFusedElementwiseDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            input_count,
+            (infiniopTensorDescriptor_t * input_count)(*[t.descriptor for t in x]),
+            len(nodes),
+            c_nodes,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in x + [y]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetFusedElementwiseWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+    x_ptrs = (c_void_p * input_count)(*[t.data() for t in x])
+
+    def lib_fused_elementwise():
+        check_error(
+            LIBINFINIOP.infiniopFusedElementwise(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x_ptrs,
+                None,
+            )
+        )
+
+    lib_fused_elementwise()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: reference(*[t.torch_tensor() for t in x]), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_fused_elementwise(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyFusedElementwiseDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -1,3 +1,7 @@
+import os
+import subprocess
+import sys
+import tempfile
 import torch
 import ctypes
 from ctypes import c_uint64
@@ -15,6 +19,7 @@ from libinfiniop import (
     InfiniDtype,
     InfiniDtypeNames,
     InfiniDeviceNames,
+    InfiniDeviceEnum,
     infiniopOperatorDescriptor_t,
 )
 
@@ -29,8 +34,20 @@ _TEST_CASES = [
     (1.0, 0.0, (1, 2048), (2048, 2048), (1, 2048), (4096, 1), (4096, 1), (4096, 1)),
     (1.0, 1.0, (6, 2048), (2048, 2560), (6, 2560), (2048, 1), (1, 2048), (2560, 1)),
     (1.0 / 8.0, 0.0, (4, 8 * 6, 64), (4, 64, 6), (4, 8 * 6, 6), None, None, None),
+    (0.5, 2.0, (37, 513), (513, 71), (37, 71), (1, 37), None, (1, 37)),
+    (1.0, 0.5, (3, 37, 19), (1, 19, 70), (3, 37, 70), None, None, None),
+    (0.5, 1.5, (1, 19), (19, 77), (1, 77), None, (1, 19), None),
 ]
 
+# Small shapes for the CPU tuning cache round trip, so that tuning stays fast
+_TUNING_CASES = [
+    (1.0, 0.0, (1, 64), (64, 96), (1, 96), None, None, None),
+    (1.0, 0.0, (33, 65), (65, 31), (33, 31), None, None, None),
+]
+
+# Set in the child processes started by test_tuning_cache
+_TUNING_CHILD_ENV = "INFINIOP_TEST_GEMM_TUNING_CHILD"
+
 # Data types used for testing
 _TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
 
@@ -87,6 +104,7 @@ def test(
     a = TestTensor(a_shape, a_stride, dtype, device)
     b = TestTensor(b_shape, b_stride, dtype, device)
     c = TestTensor(c_shape, c_stride, dtype, device, mode="ones")
+    c_prepacked = TestTensor(c_shape, c_stride, dtype, device, mode="ones")
     ans = TestTensor(c_shape, c_stride, dtype, device, mode="zeros")
 
     # Compute the PyTorch reference result
@@ -155,6 +173,37 @@ def test(
 
     assert torch.allclose(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
 
+    # B prepacked once, then reused by every call (CPU only)
+    if device == InfiniDeviceEnum.CPU:
+        packed_b_size = c_uint64(0)
+        check_error(
+            LIBINFINIOP.infiniopGetGemmPackedBSize(
+                descriptor, ctypes.byref(packed_b_size)
+            )
+        )
+        packed_b = TestWorkspace(packed_b_size.value, device)
+        check_error(
+            LIBINFINIOP.infiniopGemmPrepackB(
+                descriptor, packed_b.data(), b.data(), None
+            )
+        )
+        check_error(
+            LIBINFINIOP.infiniopGemmPrepacked(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c_prepacked.data(),
+                a.data(),
+                packed_b.data(),
+                alpha,
+                beta,
+                None,
+            )
+        )
+        assert torch.allclose(
+            c_prepacked.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol
+        )
+
     # Profiling workflow
     if PROFILE:
         # fmt: off
@@ -164,6 +213,38 @@ def test(
     check_error(LIBINFINIOP.infiniopDestroyGemmDescriptor(descriptor))
 
 
+# Tuning cache round trip (CPU only): a child process with INFINIOP_GEMM_TUNE=1
+# tunes _TUNING_CASES and writes the cache; a second child loads it and must
+# find every shape, so it neither re-tunes nor appends, and both stay correct.
+def test_tuning_cache(handle, device, dtype=InfiniDtype.F32, sync=None):
+    if device != InfiniDeviceEnum.CPU:
+        return
+    print(f"Testing Gemm tuning cache on {InfiniDeviceNames[device]}")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "gemm_tuning.txt")
+        env = dict(
+            os.environ,
+            INFINIOP_GEMM_TUNING_CACHE=path,
+            INFINIOP_GEMM_TUNE="1",
+            **{_TUNING_CHILD_ENV: "1"},
+        )
+        command = [sys.executable, os.path.abspath(__file__), "--cpu"]
+
+        subprocess.run(command, env=env, check=True)
+        with open(path) as f:
+            stored = f.read()
+        lines = stored.splitlines()
+        assert lines[0].startswith("#")
+        entries = [line.split() for line in lines[1:]]
+        assert len(entries) == len(_TUNING_CASES)
+        assert all(entry[7] in ("gemv", "gemm") for entry in entries)
+
+        subprocess.run(command, env=env, check=True)
+        with open(path) as f:
+            assert f.read() == stored
+
+
 # ==============================================================================
 #  Main Execution
 # ==============================================================================
@@ -177,7 +258,13 @@ if __name__ == "__main__":
     NUM_ITERATIONS = args.num_iterations
 
     # Execute tests
+    if os.environ.get(_TUNING_CHILD_ENV):
+        for device in get_test_devices(args):
+            test_operator(device, test, _TUNING_CASES, [InfiniDtype.F32])
+        sys.exit(0)
+
     for device in get_test_devices(args):
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        test_operator(device, test_tuning_cache, [()], [InfiniDtype.F32])
 
     print("\033[92mTest passed!\033[0m")
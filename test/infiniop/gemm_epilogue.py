@@ -0,0 +1,217 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+from enum import Enum
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # alpha, beta, a_shape, b_shape, c_shape, a_stride, b_stride, c_stride, bias, residual, residual_stride
+    (1.0, 0.0, (6, 2048), (2048, 2560), (6, 2560), None, (1, 2048), None, True, False, None),
+    (1.0, 1.0, (37, 513), (513, 71), (37, 71), None, None, None, True, True, (1, 37)),
+    (0.5, 0.0, (37, 513), (513, 71), (37, 71), (1, 37), None, (1, 37), False, True, None),
+    (1.0, 0.5, (3, 37, 19), (1, 19, 70), (3, 37, 70), None, None, None, True, True, None),
+    (1.0, 0.0, (1, 2048), (2048, 2048), (1, 2048), None, None, None, True, True, None),
+]
+
+
+class Activation(Enum):
+    NONE = 0
+    RELU = 1
+    SILU = 2
+    GELU = 3
+
+
+_ACTIVATIONS = [Activation.NONE, Activation.RELU, Activation.SILU, Activation.GELU]
+
+_TEST_CASES = [
+    test_case + (activation,)
+    for test_case in _TEST_CASES_
+    for activation in _ACTIVATIONS
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-3},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+# PyTorch implementation: act(alpha * a @ b + beta * c + bias) + residual
+def gemm_epilogue(d, _c, beta, _a, _b, alpha, bias, residual, activation):
+    y = torch.matmul(_a.float(), _b.float()).mul_(alpha).add_(_c.float(), alpha=beta)
+    if bias is not None:
+        y.add_(bias.float())
+    if activation == Activation.RELU:
+        y = torch.relu(y)
+    elif activation == Activation.SILU:
+        y = torch.nn.functional.silu(y)
+    elif activation == Activation.GELU:
+        y = torch.nn.functional.gelu(y, approximate="tanh")
+    if residual is not None:
+        y.add_(residual.float())
+    d.copy_(y)
+
+
+def test(
+    handle,
+    device,
+    alpha,
+    beta,
+    a_shape,
+    b_shape,
+    c_shape,
+    a_stride=None,
+    b_stride=None,
+    c_stride=None,
+    use_bias=True,
+    use_residual=False,
+    residual_stride=None,
+    activation=Activation.NONE,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # 带后处理的矩阵乘目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing GemmEpilogue on {InfiniDeviceNames[device]} with alpha:{alpha}, beta:{beta},"
+        f" a_shape:{a_shape}, b_shape:{b_shape}, c_shape:{c_shape},"
+        f" a_stride:{a_stride}, b_stride:{b_stride}, c_stride:{c_stride},"
+        f" bias:{use_bias}, residual:{use_residual}, residual_stride:{residual_stride},"
+        f" activation:{activation.name}, dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    a = TestTensor(a_shape, a_stride, dtype, device)
+    b = TestTensor(b_shape, b_stride, dtype, device)
+    c = TestTensor(c_shape, c_stride, dtype, device, mode="ones")
+    bias = TestTensor((c_shape[-1],), None, dtype, device) if use_bias else None
+    residual = (
+        TestTensor(c_shape, residual_stride, dtype, device) if use_residual else None
+    )
+    ans = TestTensor(c_shape, c_stride, dtype, device, mode="zeros")
+
+    def torch_gemm_epilogue():
+        gemm_epilogue(
+            ans.torch_tensor(),
+            c.torch_tensor(),
+            beta,
+            a.torch_tensor(),
+            b.torch_tensor(),
+            alpha,
+            bias.torch_tensor() if bias is not None else None,
+            residual.torch_tensor() if residual is not None else None,
+            activation,
+        )
+
+    torch_gemm_epilogue()
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGemmEpilogueDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            c.descriptor,
+            a.descriptor,
+            b.descriptor,
+            bias.descriptor if bias is not None else None,
+            residual.descriptor if residual is not None else None,
+            activation.value,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [a, b, c, bias, residual]:
+        if tensor is not None:
+            tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetGemmWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_gemm_epilogue():
+        check_error(
+            LIBINFINIOP.infiniopGemmEpilogue(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c.data(),
+                a.data(),
+                b.data(),
+                bias.data() if bias is not None else None,
+                residual.data() if residual is not None else None,
+                alpha,
+                beta,
+                None,
+            )
+        )
+
+    lib_gemm_epilogue()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+    assert torch.allclose(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch_gemm_epilogue(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_gemm_epilogue(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyGemmDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
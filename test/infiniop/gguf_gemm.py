@@ -0,0 +1,217 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+from enum import Enum
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # m, n, k, a_stride
+    (1, 4096, 4096, None),
+    (7, 40, 768, None),
+    (19, 17, 256, (1, 19)),
+]
+
+
+class GGUFType(Enum):
+    Q4_0 = 2
+    Q8_0 = 8
+    Q4_K = 12
+
+
+# 每种格式一个块的元素数、字节数，以及随机缩放系数的量级（使权重约为 0.1）
+_BLOCK = {
+    GGUFType.Q4_0: (32, 18, 0.02),
+    GGUFType.Q8_0: (32, 34, 0.002),
+    GGUFType.Q4_K: (256, 144, 0.0005),
+}
+
+_TEST_CASES = [
+    test_case + (w_type,)
+    for test_case in _TEST_CASES_
+    for w_type in [GGUFType.Q4_0, GGUFType.Q8_0, GGUFType.Q4_K]
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# 激活按块量化为 8 位，误差远大于浮点舍入
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 2e-2, "rtol": 1e-2},
+    InfiniDtype.F32: {"atol": 2e-2, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 3e-2, "rtol": 2e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def random_gguf_weight(w_type, n, k):
+    """随机生成 GGUF 权重的原始字节 [n, row_bytes]，以及反量化后的 [n, k] 参考值"""
+    block, block_bytes, scale = _BLOCK[w_type]
+    nb = k // block
+    raw = torch.randint(0, 256, (n, nb, block_bytes), dtype=torch.uint8)
+
+    def set_half(offset, value):
+        raw[:, :, offset : offset + 2] = value.view(torch.uint8).view(n, nb, 2)
+        return value.double()
+
+    d = set_half(0, ((torch.rand(n, nb, 1) + 0.1) * scale).half())
+    if w_type == GGUFType.Q4_0:
+        qs = raw[:, :, 2:]
+        q = torch.cat([qs & 0xF, qs >> 4], dim=-1).double() - 8
+        w = d * q
+    elif w_type == GGUFType.Q8_0:
+        w = d * raw[:, :, 2:].view(torch.int8).double()
+    else:
+        dmin = set_half(2, (torch.rand(n, nb, 1) * scale).half())
+        s = raw[:, :, 4:16].long()
+        sc, mn = [], []
+        for j in range(8):
+            if j < 4:
+                sc.append(s[:, :, j] & 63)
+                mn.append(s[:, :, j + 4] & 63)
+            else:
+                sc.append((s[:, :, j + 4] & 0xF) | ((s[:, :, j - 4] >> 6) << 4))
+                mn.append((s[:, :, j + 4] >> 4) | ((s[:, :, j] >> 6) << 4))
+        sc = torch.stack(sc, dim=-1).double().unsqueeze(-1)
+        mn = torch.stack(mn, dim=-1).double().unsqueeze(-1)
+        # 每 32 字节的低 4 位属于一个子块，高 4 位属于下一个子块
+        qs = raw[:, :, 16:].reshape(n, nb, 4, 1, 32)
+        q = torch.cat([qs & 0xF, qs >> 4], dim=3).view(n, nb, 8, 32).double()
+        w = d.unsqueeze(-1) * sc * q - dmin.unsqueeze(-1) * mn
+
+    return raw.view(n, nb * block_bytes), w.reshape(n, k)
+
+
+def gguf_gemm(c, a, w):
+    c.copy_(torch.matmul(a.double(), w.T))
+
+
+def test(
+    handle,
+    device,
+    m,
+    n,
+    k,
+    a_stride=None,
+    w_type=GGUFType.Q4_0,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # GGUF 权重的矩阵乘目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing GGUFGemm on {InfiniDeviceNames[device]} with m:{m} n:{n} k:{k}"
+        f" a_stride:{a_stride} w_type:{w_type.name} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    raw, w_ref = random_gguf_weight(w_type, n, k)
+    w = TestTensor(
+        raw.shape, raw.stride(), InfiniDtype.U8, device, mode="manual", set_tensor=raw
+    )
+    a = TestTensor((m, k), a_stride, dtype, device, bias=-0.5)
+    c = TestTensor((m, n), None, dtype, device, mode="zeros")
+    ans = TestTensor((m, n), None, dtype, device, mode="zeros")
+
+    def torch_gguf_gemm():
+        gguf_gemm(ans.torch_tensor(), a.torch_tensor(), w_ref)
+
+    torch_gguf_gemm()
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGGUFGemmDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            c.descriptor,
+            a.descriptor,
+            w.descriptor,
+            w_type.value,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [a, w, c]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetGGUFGemmWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_gguf_gemm():
+        check_error(
+            LIBINFINIOP.infiniopGGUFGemm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c.data(),
+                a.data(),
+                w.data(),
+                None,
+            )
+        )
+
+    lib_gguf_gemm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+    assert torch.allclose(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch_gguf_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_gguf_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyGGUFGemmDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
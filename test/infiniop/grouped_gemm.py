@@ -0,0 +1,192 @@
+import torch
+import ctypes
+from ctypes import c_uint64, c_void_p
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+    infiniopTensorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES = [
+    # alpha, beta, groups of (a_shape, b_shape, c_shape)
+    (1.0, 0.0, [((1, 256), (256, 512), (1, 512))]),
+    # MoE 专家：每个专家的 token 数不同，可以为 0
+    (
+        1.0,
+        0.0,
+        [((t, 512), (512, 384), (t, 384)) for t in [3, 17, 1, 40, 0, 25, 5, 9]],
+    ),
+    # 不同形状、带批次与广播的组混合
+    (
+        0.5,
+        1.5,
+        [
+            ((7, 64), (64, 96), (7, 96)),
+            ((2, 4, 64), (2, 64, 80), (2, 4, 80)),
+            ((3, 37, 19), (1, 19, 70), (3, 37, 70)),
+            ((100, 300), (300, 129), (100, 129)),
+            ((5, 0), (0, 7), (5, 7)),
+        ],
+    ),
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-3},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def gemm(d, _c, beta, _a, _b, alpha):
+    d.copy_(alpha * torch.matmul(_a.float(), _b.float()) + beta * _c.float())
+
+
+def test(
+    handle,
+    device,
+    alpha,
+    beta,
+    groups,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # 分组矩阵乘目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing GroupedGemm on {InfiniDeviceNames[device]} with alpha:{alpha}, beta:{beta},"
+        f" groups:{len(groups)}, dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    a, b, c, ans = [], [], [], []
+    for a_shape, b_shape, c_shape in groups:
+        a.append(TestTensor(a_shape, None, dtype, device))
+        b.append(TestTensor(b_shape, None, dtype, device))
+        c.append(TestTensor(c_shape, None, dtype, device, mode="ones"))
+        ans.append(TestTensor(c_shape, None, dtype, device, mode="zeros"))
+
+    def torch_grouped_gemm():
+        for i in range(len(groups)):
+            gemm(
+                ans[i].torch_tensor(),
+                c[i].torch_tensor(),
+                beta,
+                a[i].torch_tensor(),
+                b[i].torch_tensor(),
+                alpha,
+            )
+
+    torch_grouped_gemm()
+
+    if sync is not None:
+        sync()
+
+    count = len(groups)
+    descs = lambda tensors: (infiniopTensorDescriptor_t * count)(
+        *[t.descriptor for t in tensors]
+    )
+    ptrs = lambda tensors: (c_void_p * count)(*[t.data() for t in tensors])
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGroupedGemmDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            count,
+            descs(c),
+            descs(a),
+            descs(b),
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in a + b + c:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetGroupedGemmWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+    c_ptrs, a_ptrs, b_ptrs = ptrs(c), ptrs(a), ptrs(b)
+
+    def lib_grouped_gemm():
+        check_error(
+            LIBINFINIOP.infiniopGroupedGemm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c_ptrs,
+                a_ptrs,
+                b_ptrs,
+                alpha,
+                beta,
+                None,
+            )
+        )
+
+    lib_grouped_gemm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    for i in range(count):
+        if DEBUG:
+            debug(c[i].actual_tensor(), ans[i].torch_tensor(), atol=atol, rtol=rtol)
+        assert torch.allclose(
+            c[i].actual_tensor(), ans[i].torch_tensor(), atol=atol, rtol=rtol
+        )
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch_grouped_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_grouped_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyGroupedGemmDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
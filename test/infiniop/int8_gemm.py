@@ -0,0 +1,187 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES = [
+    # a_shape, b_shape, c_shape, a_stride, b_stride, c_stride, batched_scales
+    ((1, 2048), (2048, 2048), (1, 2048), None, (1, 2048), None, False),
+    ((6, 2048), (2048, 2560), (6, 2560), None, (1, 2048), None, False),
+    ((37, 513), (513, 71), (37, 71), None, None, None, False),
+    ((37, 513), (513, 71), (37, 71), (1, 37), (1, 513), (1, 37), False),
+    ((4, 48, 64), (4, 64, 6), (4, 48, 6), None, None, None, True),
+    ((3, 37, 19), (1, 19, 70), (3, 37, 70), None, None, None, False),
+]
+
+# Data types of c used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 0, "rtol": 1e-3},
+    InfiniDtype.F32: {"atol": 0, "rtol": 1e-5},
+    InfiniDtype.BF16: {"atol": 0, "rtol": 8e-3},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def random_int8(shape, stride, device):
+    if stride is None:
+        stride = torch.empty(shape).stride()
+    data = torch.empty_strided(shape, stride, dtype=torch.int8)
+    data.copy_(torch.randint(-128, 128, shape, dtype=torch.int8))
+    return TestTensor(
+        shape, stride, InfiniDtype.I8, device, mode="manual", set_tensor=data
+    )
+
+
+# PyTorch implementation: per-row scale of a times per-column scale of b
+def int8_gemm(d, _a, _b, a_scale, b_scale):
+    acc = torch.matmul(_a.double(), _b.double())
+    d.copy_(acc * a_scale.double().unsqueeze(-1) * b_scale.double().unsqueeze(-2))
+
+
+def test(
+    handle,
+    device,
+    a_shape,
+    b_shape,
+    c_shape,
+    a_stride=None,
+    b_stride=None,
+    c_stride=None,
+    batched_scales=False,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # Int8Gemm 目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing Int8Gemm on {InfiniDeviceNames[device]} with"
+        f" a_shape:{a_shape}, b_shape:{b_shape}, c_shape:{c_shape},"
+        f" a_stride:{a_stride}, b_stride:{b_stride}, c_stride:{c_stride},"
+        f" batched_scales:{batched_scales}, dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    a = random_int8(a_shape, a_stride, device)
+    b = random_int8(b_shape, b_stride, device)
+    c = TestTensor(c_shape, c_stride, dtype, device, mode="zeros")
+    a_scale_shape = a_shape[:-1] if batched_scales else a_shape[-2:-1]
+    b_scale_shape = b_shape[:-2] + b_shape[-1:] if batched_scales else b_shape[-1:]
+    a_scale = TestTensor(a_scale_shape, None, InfiniDtype.F32, device, scale=0.01)
+    b_scale = TestTensor(b_scale_shape, None, InfiniDtype.F32, device, scale=0.01)
+    ans = TestTensor(c_shape, c_stride, dtype, device, mode="zeros")
+
+    def torch_int8_gemm():
+        int8_gemm(
+            ans.torch_tensor(),
+            a.torch_tensor(),
+            b.torch_tensor(),
+            a_scale.torch_tensor(),
+            b_scale.torch_tensor(),
+        )
+
+    torch_int8_gemm()
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateInt8GemmDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            c.descriptor,
+            a.descriptor,
+            b.descriptor,
+            a_scale.descriptor,
+            b_scale.descriptor,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [a, b, c, a_scale, b_scale]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetInt8GemmWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_int8_gemm():
+        check_error(
+            LIBINFINIOP.infiniopInt8Gemm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                c.data(),
+                a.data(),
+                b.data(),
+                a_scale.data(),
+                b_scale.data(),
+                None,
+            )
+        )
+
+    lib_int8_gemm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+    assert torch.allclose(c.actual_tensor(), ans.torch_tensor(), atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch_int8_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_int8_gemm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyInt8GemmDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
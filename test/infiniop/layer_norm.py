@@ -0,0 +1,177 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, y_stride, x_stride, bias
+    ((1, 4), None, None, True),
+    ((3, 17), None, None, False),
+    ((16, 2048), None, None, True),
+    ((16, 2048), None, None, False),
+    ((16, 2048), (4096, 1), (4096, 1), True),
+    ((5, 513), None, (1000, 1), True),
+]
+
+# w (weight) and b (bias) types
+# Note: 'None' means the same as input dtype
+_WEIGHT_DTYPES = [None, InfiniDtype.F32]
+# x types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Form the test cases by appending each element of _WEIGHT_DTYPES to each tuple in _TEST_CASES_
+_TEST_CASES = [
+    test_case + (w_dtype,) for test_case in _TEST_CASES_ for w_dtype in _WEIGHT_DTYPES
+]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 2e-3, "rtol": 2e-3},
+    InfiniDtype.BF16: {"atol": 8e-3, "rtol": 8e-3},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-5},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def layer_norm(x, w, b, eps):
+    # 半精度输入的统计量在 fp32 中计算
+    y = torch.nn.functional.layer_norm(
+        x.float(),
+        x.shape[-1:],
+        w.float(),
+        b.float() if b is not None else None,
+        eps,
+    )
+    return y.to(x.dtype)
+
+
+def test(
+    handle,
+    device,
+    shape,
+    y_stride,
+    x_stride,
+    bias,
+    w_dtype=InfiniDtype.F32,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # LayerNorm 目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    w_dtype = w_dtype if w_dtype else dtype
+    print(
+        f"Testing LayerNorm on {InfiniDeviceNames[device]} with shape:{shape} y_stride:{y_stride} x_stride:{x_stride}"
+        f" bias:{bias} w_dtype:{InfiniDtypeNames[w_dtype]} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    y = TestTensor(shape, y_stride, dtype, device, mode="ones")
+    x = TestTensor(shape, x_stride, dtype, device)
+    w = TestTensor(shape[-1:], None, w_dtype, device)
+    b = TestTensor(shape[-1:], None, w_dtype, device) if bias else None
+
+    eps = 1e-5
+    ans = layer_norm(
+        x.torch_tensor(),
+        w.torch_tensor(),
+        b.torch_tensor() if bias else None,
+        eps,
+    )
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateLayerNormDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            x.descriptor,
+            w.descriptor,
+            b.descriptor if bias else None,
+            eps,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [x, y, w] + ([b] if bias else []):
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetLayerNormWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, y.device)
+
+    def lib_layer_norm():
+        check_error(
+            LIBINFINIOP.infiniopLayerNorm(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                w.data(),
+                b.data() if bias else None,
+                None,
+            )
+        )
+
+    lib_layer_norm()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: layer_norm(x.torch_tensor(), w.torch_tensor(), b.torch_tensor() if bias else None, eps), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_layer_norm(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyLayerNormDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -2,6 +2,7 @@ from .structs import (
     infiniopHandle_t,
     infiniopTensorDescriptor_t,
     infiniopOperatorDescriptor_t,
+    infiniopElementwiseNode_t,
 )
 
 from ctypes import c_int32, c_void_p, c_size_t, POINTER, c_float
@@ -55,6 +56,45 @@ def add_(lib):
     ]
 
 
+@OpRegister.operator
+def add_rms_norm_(lib):
+    lib.infiniopCreateAddRMSNormDescriptor.restype = c_int32
+    lib.infiniopCreateAddRMSNormDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_float,
+    ]
+
+    lib.infiniopGetAddRMSNormWorkspaceSize.restype = c_int32
+    lib.infiniopGetAddRMSNormWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopAddRMSNorm.restype = c_int32
+    lib.infiniopAddRMSNorm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyAddRMSNormDescriptor.restype = c_int32
+    lib.infiniopDestroyAddRMSNormDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
 @OpRegister.operator
 def attention_(lib):
     lib.infiniopCreateAttentionDescriptor.restype = c_int32
@@ -96,6 +136,36 @@ def attention_(lib):
     ]
 
 
+@OpRegister.operator
+def cast_(lib):
+    lib.infiniopCreateCastDescriptor.restype = c_int32
+    lib.infiniopCreateCastDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+    ]
+
+    lib.infiniopGetCastWorkspaceSize.restype = c_int32
+    lib.infiniopGetCastWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopCast.restype = c_int32
+    lib.infiniopCast.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyCastDescriptor.restype = c_int32
+    lib.infiniopDestroyCastDescriptor.argtypes = [infiniopOperatorDescriptor_t]
+
+
 @OpRegister.operator
 def causal_softmax_(lib):
     lib.infiniopCreateCausalSoftmaxDescriptor.restype = c_int32
@@ -197,11 +267,247 @@ def gemm_(lib):
         c_void_p,
     ]
 
+    lib.infiniopCreateGemmEpilogueDescriptor.restype = c_int32
+    lib.infiniopCreateGemmEpilogueDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_int32,
+    ]
+
+    lib.infiniopGemmEpilogue.restype = c_int32
+    lib.infiniopGemmEpilogue.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_float,
+        c_float,
+        c_void_p,
+    ]
+
     lib.infiniopDestroyGemmDescriptor.restype = c_int32
     lib.infiniopDestroyGemmDescriptor.argtypes = [
         infiniopOperatorDescriptor_t,
     ]
 
+    lib.infiniopGetGemmPackedBSize.restype = c_int32
+    lib.infiniopGetGemmPackedBSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopGemmPrepackB.restype = c_int32
+    lib.infiniopGemmPrepackB.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopGemmPrepacked.restype = c_int32
+    lib.infiniopGemmPrepacked.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_float,
+        c_float,
+        c_void_p,
+    ]
+
+
+@OpRegister.operator
+def int8_gemm_(lib):
+    lib.infiniopCreateInt8GemmDescriptor.restype = c_int32
+    lib.infiniopCreateInt8GemmDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+    ]
+
+    lib.infiniopGetInt8GemmWorkspaceSize.restype = c_int32
+    lib.infiniopGetInt8GemmWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopInt8Gemm.restype = c_int32
+    lib.infiniopInt8Gemm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyInt8GemmDescriptor.restype = c_int32
+    lib.infiniopDestroyInt8GemmDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def gguf_gemm_(lib):
+    lib.infiniopCreateGGUFGemmDescriptor.restype = c_int32
+    lib.infiniopCreateGGUFGemmDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,  # c_desc
+        infiniopTensorDescriptor_t,  # a_desc
+        infiniopTensorDescriptor_t,  # w_desc
+        c_int32,  # w_type
+    ]
+
+    lib.infiniopGetGGUFGemmWorkspaceSize.restype = c_int32
+    lib.infiniopGetGGUFGemmWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopGGUFGemm.restype = c_int32
+    lib.infiniopGGUFGemm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,  # workspace
+        c_size_t,  # workspace_size
+        c_void_p,  # c
+        c_void_p,  # a
+        c_void_p,  # w
+        c_void_p,  # stream
+    ]
+
+    lib.infiniopDestroyGGUFGemmDescriptor.restype = c_int32
+    lib.infiniopDestroyGGUFGemmDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def grouped_gemm_(lib):
+    lib.infiniopCreateGroupedGemmDescriptor.restype = c_int32
+    lib.infiniopCreateGroupedGemmDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        c_size_t,  # group_count
+        POINTER(infiniopTensorDescriptor_t),  # c_descs
+        POINTER(infiniopTensorDescriptor_t),  # a_descs
+        POINTER(infiniopTensorDescriptor_t),  # b_descs
+    ]
+
+    lib.infiniopGetGroupedGemmWorkspaceSize.restype = c_int32
+    lib.infiniopGetGroupedGemmWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopGroupedGemm.restype = c_int32
+    lib.infiniopGroupedGemm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,  # workspace
+        c_size_t,  # workspace_size
+        POINTER(c_void_p),  # c
+        POINTER(c_void_p),  # a
+        POINTER(c_void_p),  # b
+        c_float,  # alpha
+        c_float,  # beta
+        c_void_p,  # stream
+    ]
+
+    lib.infiniopDestroyGroupedGemmDescriptor.restype = c_int32
+    lib.infiniopDestroyGroupedGemmDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def fused_elementwise_(lib):
+    lib.infiniopCreateFusedElementwiseDescriptor.restype = c_int32
+    lib.infiniopCreateFusedElementwiseDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,  # y_desc
+        c_size_t,  # input_count
+        POINTER(infiniopTensorDescriptor_t),  # x_descs
+        c_size_t,  # node_count
+        POINTER(infiniopElementwiseNode_t),  # nodes
+    ]
+
+    lib.infiniopGetFusedElementwiseWorkspaceSize.restype = c_int32
+    lib.infiniopGetFusedElementwiseWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopFusedElementwise.restype = c_int32
+    lib.infiniopFusedElementwise.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,  # workspace
+        c_size_t,  # workspace_size
+        c_void_p,  # y
+        POINTER(c_void_p),  # x
+        c_void_p,  # stream
+    ]
+
+    lib.infiniopDestroyFusedElementwiseDescriptor.restype = c_int32
+    lib.infiniopDestroyFusedElementwiseDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def layer_norm_(lib):
+    lib.infiniopCreateLayerNormDescriptor.restype = c_int32
+    lib.infiniopCreateLayerNormDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_float,
+    ]
+
+    lib.infiniopGetLayerNormWorkspaceSize.restype = c_int32
+    lib.infiniopGetLayerNormWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopLayerNorm.restype = c_int32
+    lib.infiniopLayerNorm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyLayerNormDescriptor.restype = c_int32
+    lib.infiniopDestroyLayerNormDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
 
 @OpRegister.operator
 def mul_(lib):
@@ -294,6 +600,40 @@ def rearrange_(lib):
     lib.infiniopDestroyRearrangeDescriptor.argtypes = [infiniopOperatorDescriptor_t]
 
 
+@OpRegister.operator
+def reduce_(lib):
+    lib.infiniopCreateReduceDescriptor.restype = c_int32
+    lib.infiniopCreateReduceDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        POINTER(c_size_t),  # axes
+        c_size_t,  # axis_count
+        c_int32,  # keepdim
+        c_int32,  # op
+    ]
+
+    lib.infiniopGetReduceWorkspaceSize.restype = c_int32
+    lib.infiniopGetReduceWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopReduce.restype = c_int32
+    lib.infiniopReduce.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyReduceDescriptor.restype = c_int32
+    lib.infiniopDestroyReduceDescriptor.argtypes = [infiniopOperatorDescriptor_t]
+
+
 @OpRegister.operator
 def relu_(lib):
     lib.infiniopCreateReluDescriptor.restype = c_int32
@@ -526,4 +866,43 @@ def awq_dequantize_(lib):
         infiniopOperatorDescriptor_t,
     ]
 
+
+@OpRegister.operator
+def awq_gemm_(lib):
+    lib.infiniopCreateAWQGemmDescriptor.restype = c_int32
+    lib.infiniopCreateAWQGemmDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,  # c_desc
+        infiniopTensorDescriptor_t,  # a_desc
+        infiniopTensorDescriptor_t,  # qweight_desc
+        infiniopTensorDescriptor_t,  # zeros_desc
+        infiniopTensorDescriptor_t,  # scales_desc
+        c_int32,  # group_size
+    ]
+
+    lib.infiniopGetAWQGemmWorkspaceSize.restype = c_int32
+    lib.infiniopGetAWQGemmWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopAWQGemm.restype = c_int32
+    lib.infiniopAWQGemm.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,  # workspace
+        c_size_t,  # workspace_size
+        c_void_p,  # c
+        c_void_p,  # a
+        c_void_p,  # qweight
+        c_void_p,  # zeros
+        c_void_p,  # scales
+        c_void_p,  # stream
+    ]
+
+    lib.infiniopDestroyAWQGemmDescriptor.restype = c_int32
+    lib.infiniopDestroyAWQGemmDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
     
\ No newline at end of file
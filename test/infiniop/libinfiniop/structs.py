@@ -1,4 +1,4 @@
-from ctypes import c_int, Structure, POINTER
+from ctypes import c_int, c_uint, Structure, POINTER
 
 
 class TensorDescriptor(Structure):
@@ -20,3 +20,10 @@ class OpDescriptor(Structure):
 
 
 infiniopOperatorDescriptor_t = POINTER(OpDescriptor)
+
+
+class ElementwiseNode(Structure):
+    _fields_ = [("op", c_int), ("operands", c_uint * 3)]
+
+
+infiniopElementwiseNode_t = ElementwiseNode
@@ -0,0 +1,206 @@
+import torch
+import ctypes
+from ctypes import c_uint64, c_size_t
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# infiniopReduceOp_t
+SUM, MEAN, MAX, MIN, PROD, L2 = range(6)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+
+def _prod(x, dim, keepdim):
+    # torch.prod 一次只能规约一个维度
+    for d in sorted(dim, reverse=True):
+        x = torch.prod(x, d, keepdim)
+    return x
+
+
+# 各规约的 torch 参考实现
+_REDUCTIONS = {
+    "sum": (SUM, lambda x, dim, keepdim: torch.sum(x, dim, keepdim)),
+    "mean": (MEAN, lambda x, dim, keepdim: torch.mean(x, dim, keepdim)),
+    "max": (MAX, lambda x, dim, keepdim: torch.amax(x, dim, keepdim)),
+    "min": (MIN, lambda x, dim, keepdim: torch.amin(x, dim, keepdim)),
+    "prod": (PROD, _prod),
+    "l2": (L2, lambda x, dim, keepdim: torch.linalg.vector_norm(x, 2, dim, keepdim)),
+}
+
+_TEST_CASES_ = [
+    # shape, x_stride, axes, keepdim
+    ((13, 4), None, (1,), False),
+    ((13, 4), None, (0,), True),
+    ((13, 4), (10, 1), (0, 1), False),
+    ((16, 5632), None, (1,), False),
+    ((16, 5632), None, (0,), False),
+    ((4, 5632), None, (1,), True),
+    ((4, 6, 512), None, (0, 2), False),
+    ((4, 6, 512), (1, 4, 24), (1,), True),
+    ((8, 3, 64, 64), None, (2, 3), True),
+    ((2, 4096, 4), None, (1,), False),
+]
+
+_TEST_CASES = [
+    test_case + (reduction, False)
+    for test_case in _TEST_CASES_
+    for reduction in _REDUCTIONS
+]
+
+# max/min with NaN in the input: the result is NaN wherever a reduced element is
+# NaN, whether it lands in the first operand, the second operand or the tail
+_TEST_CASES += [
+    test_case + (reduction, True)
+    for test_case in _TEST_CASES_
+    for reduction in ("max", "min")
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-3},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-5},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 1e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def test(
+    handle,
+    device,
+    shape,
+    x_stride,
+    axes,
+    keepdim,
+    reduction,
+    with_nan,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    # 规约算子目前只在 CPU 上实现
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    op, reference = _REDUCTIONS[reduction]
+    print(
+        f"Testing Reduce on {InfiniDeviceNames[device]} with reduction:{reduction} shape:{shape} x_stride:{x_stride} "
+        f"axes:{axes} keepdim:{keepdim} with_nan:{with_nan} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    # 连乘的因子取在 1 附近，结果不会溢出或下溢
+    if op == PROD:
+        values = torch.rand(shape) * 0.1 + 0.95
+    else:
+        values = torch.rand(shape) * 2 - 1
+    if with_nan:
+        flat = values.view(-1)
+        flat[[0, flat.numel() // 3, flat.numel() - 1]] = float("nan")
+        flat[torch.randint(flat.numel(), (4,))] = float("nan")
+    if x_stride is not None:
+        values = torch.empty_strided(shape, x_stride).copy_(values)
+    x = TestTensor(shape, x_stride, dtype, device, mode="manual", set_tensor=values)
+    y_shape = [
+        1 if i in axes else s for i, s in enumerate(shape) if keepdim or i not in axes
+    ]
+    y = TestTensor(y_shape, None, dtype, device, mode="zeros")
+
+    # 参考结果在 fp32 中计算，与库的累加精度一致
+    ans = reference(x.torch_tensor().float(), axes, keepdim).to(y.torch_tensor().dtype)
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateReduceDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            x.descriptor,
+            (c_size_t * len(axes))(*axes),
+            len(axes),
+            keepdim,
+            op,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [x, y]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetReduceWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_reduce():
+        check_error(
+            LIBINFINIOP.infiniopReduce(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                None,
+            )
+        )
+
+    lib_reduce()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol, equal_nan=with_nan)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: reference(x.torch_tensor(), axes, keepdim), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_reduce(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyReduceDescriptor(descriptor))
+
+
+# ==============================================================================
+#  Main Execution
+# ==============================================================================
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
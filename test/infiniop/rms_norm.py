@@ -36,7 +36,7 @@ _TEST_CASES_ = [
 # Note: 'None' means the same as input dtype
 _WEIGHT_DTYPES = [None, InfiniDtype.F32]
 # x types used for testing
-_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16]
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
 
 # Form the test cases by appending each element of _WEIGHT_DTYPES to each tuple in _TEST_CASES_
 _TEST_CASES = [
@@ -47,6 +47,7 @@ _TEST_CASES = [
 _TOLERANCE_MAP = {
     InfiniDtype.F16: {"atol": 2e-3, "rtol": 2e-3},
     InfiniDtype.BF16: {"atol": 8e-3, "rtol": 8e-3},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-5},
 }
 
 DEBUG = False
@@ -15,6 +15,7 @@ from libinfiniop import (
     InfiniDtype,
     InfiniDtypeNames,
     InfiniDeviceNames,
+    InfiniDeviceEnum,
     infiniopOperatorDescriptor_t,
 )
 from enum import Enum, auto
@@ -167,6 +168,49 @@ def test(
     check_error(LIBINFINIOP.infiniopDestroySwiGLUDescriptor(descriptor))
 
 
+# 使 silu 中的 exp(-x) 溢出、接近 FLT_MAX、为非规格化数或下溢的取值，以及 inf 与 NaN
+_EDGE_GATES = [
+    -float("inf"), -1e4, -104.0, -100.0, -88.5, -87.5, -20.0, 0.0,
+    20.0, 87.5, 88.8, 100.0, 103.9, 104.0, float("inf"), float("nan"),
+]
+
+
+def test_edge_values(handle, device, dtype=InfiniDtype.F32, sync=None):
+    # 只检查 CPU 的 fp32 结果：其他设备的快速数学函数可以把非规格化数冲为零
+    if device != InfiniDeviceEnum.CPU or dtype != InfiniDtype.F32:
+        return
+    print(f"Testing SwiGLU edge values on {InfiniDeviceNames[device]}")
+
+    # 重复成不是向量宽度倍数的长度，使向量主体与尾部都被覆盖
+    gates = torch.tensor(_EDGE_GATES * 3, dtype=torch.float32)
+    shape = tuple(gates.shape)
+    a = TestTensor(shape, None, dtype, device, mode="ones")
+    b = TestTensor(shape, None, dtype, device, mode="manual", set_tensor=gates)
+    c = TestTensor(shape, None, dtype, device, mode="zeros")
+
+    g = gates.double()
+    ans = (g / (1 + torch.exp(-g))).float()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateSwiGLUDescriptor(
+            handle, ctypes.byref(descriptor), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+    check_error(
+        LIBINFINIOP.infiniopSwiGLU(
+            descriptor, None, 0, c.data(), a.data(), b.data(), None
+        )
+    )
+    # atol 远小于 FLT_MIN，泄漏到结果中的 FLT_MIN 量级误差也会被发现
+    if DEBUG:
+        debug(c.actual_tensor(), ans, atol=1e-40, rtol=1e-6)
+    assert torch.allclose(
+        c.actual_tensor(), ans, atol=1e-40, rtol=1e-6, equal_nan=True
+    )
+    check_error(LIBINFINIOP.infiniopDestroySwiGLUDescriptor(descriptor))
+
+
 if __name__ == "__main__":
     args = get_args()
 
@@ -178,5 +222,6 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        test_operator(device, test_edge_values, [()], _TENSOR_DTYPES)
 
     print("\033[92mTest passed!\033[0m")